@@ -6,7 +6,7 @@
 /*   By: sergio-jimenez <sergio-jimenez@student.    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/01/16 15:29:05 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/12/16 18:26:12 by sergio-jime      ###   ########.fr       */
+/*   Updated: 2026/10/19 02:42:00 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -30,6 +30,7 @@
 # include <stdio.h>
 # include <sys/stat.h>
 # include <math.h>
+# include <time.h>
 # include "libft.h"
 # include "structs.h"
 # include <mlx.h>
@@ -42,8 +43,82 @@
 # define SCREEN_HEIGHT 720
 # define MOVEMENT_SPEED 0.025
 # define ROTATION_SPEED 0.025
+# define PITCH_SPEED 0.02
+# define PITCH_MAX 0.4
 # define FOV_ANGLE 0.66
 # define WALL_MARGIN 0.125
+# define SKIP_MIN_DIST 2
+# define RAY_CACHE_SIZE 8192
+# define COLUMN_CACHE_BUCKETS 8192
+# ifndef COLUMN_CACHE_BUDGET
+#  define COLUMN_CACHE_BUDGET 0
+# endif
+# ifndef RENDER_STATS
+#  define RENDER_STATS 0
+# endif
+# ifndef INTERLACED
+#  define INTERLACED 0
+# endif
+# define INTERLACE_MAX_TURN 0.1
+# define INTERLACE_MAX_STEP 0.5
+# ifndef FOVEATED
+#  define FOVEATED 0
+# endif
+# define FOVEA_RADIUS 0.4
+# define FOVEA_MAX_STRIDE 4
+# define DDA_DOUBLE 0
+# define DDA_FLOAT 1
+# define DDA_FIXED 2
+# ifndef DDA_PRECISION
+#  define DDA_PRECISION DDA_DOUBLE
+# endif
+# define DDA_FLOAT_MAX_MAP 4096
+# define DDA_FIXED_MAX_MAP 256
+# define DDA_FIX_ONE 65536
+# define DDA_FIX_MAX_DELTA 1099511627776
+# define DDA_VALIDATE_RAYS 2000000
+# ifndef VIEW_DISTANCE
+#  define VIEW_DISTANCE 0
+# endif
+# ifndef FOG_COLOR
+#  define FOG_COLOR 0x000000
+# endif
+# define FOG_START 0.5
+# ifndef SHADING
+#  define SHADING 0
+# endif
+# define SHADE_LEVELS 32
+# define SHADE_DISTANCE 16.0
+# define SHADE_SIDE 3
+# define FLOOR_BAND 64
+# define LIGHTMAP_RES 8
+# define LIGHT_AMBIENT 0.3
+# define AO_STRENGTH 0.45
+# define AO_RADIUS 0.5
+# ifndef PLAYER_TORCH
+#  define PLAYER_TORCH 0
+# endif
+# define DYN_BENCH_SIZE 512
+# define DYN_BENCH_LIGHTS 32
+# define DYN_BENCH_RADIUS 8
+# define DYN_BENCH_FRAMES 100
+# define SPRITE_NEAR 0.1
+# ifndef SPRITE_RLE
+#  define SPRITE_RLE 1
+# endif
+# define PVS_MAX_TILES 16384
+# ifndef PVS_CACHE
+#  define PVS_CACHE 0
+# endif
+# define PVS_CACHE_MAGIC 0x32535650
+# define DOOR_SPEED 0.02
+# define DOOR_REACH 1.0
+# ifndef MAX_LAYERS
+#  define MAX_LAYERS 4
+# endif
+# define ANIM_MAX_FRAMES 64
+# define ANIM_MAX_FPS 60
+# define ANIM_CLOCK_RATE 60
 
 /* ************************************************************************** */
 /* Main Utils */
@@ -67,10 +142,31 @@ void	free_textures(char **paths);
 bool	is_line_empty(const char *line);
 bool	is_texture_line(const char *line);
 bool	is_color_line(const char *line);
+bool	is_light_line(const char *line);
+bool	is_config_line(const char *line);
 int		get_max_line_length(char **grid);
 void	normalize_map(t_map *map);
 void	ft_free_array(char **array);
 bool	check_extension(const char *path);
+bool	build_distance_field(t_map *map);
+bool	build_occupancy(t_map *map);
+bool	is_solid(t_map *map, int x, int y);
+bool	is_block_empty(t_map *map, int bx, int by);
+void	set_tile_solid(t_map *map, int x, int y, bool solid);
+bool	bake_lightmaps(t_map *map);
+bool	build_pvs(t_map *map, const char *path);
+bool	load_pvs_cache(t_map *map, const char *path);
+void	save_pvs_cache(t_map *map, const char *path);
+bool	pvs_visible(t_map *map, int from, int to);
+void	tile_fov(t_fov *f, int x, int y);
+long	fov_side(t_fov_line *l, int x, int y);
+void	fov_shallow_bump(t_fov *f, int v, int x, int y);
+void	fov_steep_bump(t_fov *f, int v, int x, int y);
+void	fov_remove_view(t_fov *f, int v);
+bool	fov_check_view(t_fov *f, int v);
+void	dilate_set(uint64_t *seen, uint64_t *tmp, int words, int width);
+bool	encode_set(t_pvs *p, uint64_t *seen, int n);
+void	decode_set(t_pvs *p, int cell, int n);
 
 /* ************************************************************************** */
 /* Parser */
@@ -84,6 +180,23 @@ bool	in_map(const char *line);
 int		parse_rgb(const char *str);
 char	**parse_color_aux(const char *line);
 char	**parse_texture_aux(const char *line);
+bool	parse_light(t_map *map, const char *line);
+bool	check_lights(t_map *map);
+bool	is_sprite_char(char c);
+bool	is_sprite_key(const char *line);
+bool	collect_sprites(t_map *map);
+bool	is_optional_texture(const char *line);
+int		optional_texture_index(const char *line);
+bool	is_door(t_map *map, int x, int y);
+bool	collect_doors(t_map *map);
+bool	is_grate(t_map *map, int x, int y);
+bool	collect_grates(t_map *map);
+bool	is_anim_line(const char *line);
+bool	parse_anim(t_map *map, const char *line);
+bool	is_heights_line(const char *line);
+bool	parse_heights(t_map *map, char **lines);
+double	wall_height(t_map *map, int x, int y);
+bool	is_see_through(t_map *map, int x, int y);
 
 /* ************************************************************************** */
 /* Player */
@@ -92,29 +205,107 @@ void	init_player(t_player *p, t_map *map);
 bool	is_player_direction(char c);
 char	find_player_tile(t_map *map, int *px, int *py);
 void	update_player(t_cub3d *cub);
+bool	door_blocks(t_cub3d *cub, t_ray *r);
+void	toggle_door(t_cub3d *cub);
+void	update_doors(t_cub3d *cub);
 
 /* ************************************************************************** */
 /* Render */
 
 void	render_frame(t_cub3d *cub);
+bool	init_renderer(t_cub3d *cub);
+void	free_renderer(t_cub3d *cub);
+void	print_render_stats(t_cub3d *cub);
+bool	init_fog(t_cub3d *cub);
+void	draw_fog_column(t_cub3d *cub, t_ray *r, int x);
+unsigned int	fog_blend(unsigned int c, int w);
+bool	init_shading(t_cub3d *cub);
+void	free_shading(t_cub3d *cub);
+t_img	*shade_texture(t_cub3d *cub, t_img *tex, t_ray *r, int light);
+unsigned char	*face_samples(t_map *map, int x, int y, int f);
+int		face_light(t_map *map, t_ray *r, double wall_x);
+int		add_dyn_light(t_map *map, double x, double y, double radius);
+void	move_dyn_light(t_map *map, int id, double x, double y);
+void	apply_dyn_light(t_map *map, t_light *l, int sign);
+void	relight_tile(t_map *map, int x, int y, int sign);
+void	bench_dyn_lights(void);
 void	create_frame(t_cub3d *cub, t_img *img);
+bool	has_texture(t_cub3d *cub, int index);
+void	draw_floor_band(t_cub3d *cub, int from, int to);
+bool	init_sky(t_cub3d *cub);
+void	sky_sweep(t_cub3d *cub);
+void	draw_sky_row(t_cub3d *cub, unsigned int *row, int y);
 void	put_pixel(t_img *img, int x, int y, int color);
 
 /* ************************************************************************** */
 /* Raycast */
 
 void	raycast(t_cub3d *cub);
+void	init_ray_vars(t_cub3d *cub, t_ray *r, int x);
+void	trace_ray(t_cub3d *cub, t_ray *r);
+void	cast_column(t_cub3d *cub, int x);
+void	interlace_sync(t_cub3d *cub);
+int		column_pass(t_cub3d *cub, int x);
+bool	reproject_column(t_cub3d *cub, t_ray *r, t_ray *prev, int x);
+int		column_stride(t_cub3d *cub, int x);
+int		column_rep(t_cub3d *cub, int x);
+double	column_sample(t_cub3d *cub, int x);
+void	replicate_column(t_cub3d *cub, int x);
+void	draw_wall_spans(t_cub3d *cub);
+void	draw_wall_line_textured(t_cub3d *cub, t_ray *r, int x);
 void	calc_line_params(t_cub3d *cub, t_ray *r);
 void	calc_step_side(t_player *p, t_ray *r);
-void	calc_delta(t_ray *r);
+bool	init_camera(t_cub3d *cub);
+void	camera_sweep(t_cub3d *cub);
 int		clamp(int value, int min, int max);
+void	skip_empty_space(t_map *map, t_ray *r);
+int		block_reach(int cell, int step);
+void	perform_dda(t_cub3d *cub, t_ray *r);
+void	dda_float(t_map *map, t_player *p, t_ray *r);
+void	dda_fixed(t_map *map, t_player *p, t_ray *r);
+void	select_dda(t_cub3d *cub);
+void	validate_dda(t_cub3d *cub);
+bool	init_ray_cache(t_cub3d *cub);
+void	ray_cache_sync(t_cub3d *cub);
+bool	ray_cache_fetch(t_ray_cache *c, t_ray *r);
+void	ray_cache_store(t_ray_cache *c, t_ray *r);
+bool	init_layers(t_cub3d *cub);
+t_layer	*push_layer(t_cub3d *cub, t_ray *r);
+bool	grate_blocks(t_cub3d *cub, t_ray *r);
+bool	height_blocks(t_cub3d *cub, t_ray *r);
+int		layer_tex_x(t_img *tex, t_ray *r, int side, double wall_x);
+void	draw_face(t_cub3d *cub, t_ray *r, int x, double height);
+void	draw_layers(t_cub3d *cub, int x, double depth);
+void	flush_layers(t_cub3d *cub);
+
+/* ************************************************************************** */
+/* Sprites */
+
+bool	init_sprites(t_cub3d *cub);
+void	draw_sprites(t_cub3d *cub);
+void	draw_sprite(t_cub3d *cub, t_sprite_view *v);
+bool	encode_sprite_runs(t_img *tex, t_sprite_runs *r);
+void	free_sprite_runs(t_cub3d *cub);
+
+/* ************************************************************************** */
+/* Column cache */
+
+bool	init_column_cache(t_col_cache *c);
+void	free_column_cache(t_col_cache *c);
+void	lru_unlink(t_col_cache *c, t_col_entry *e);
+void	lru_push_front(t_col_cache *c, t_col_entry *e);
+int		col_cache_bucket(t_img *tex, int tex_x, int line_h);
+bool	col_cache_find(t_col_cache *c, t_ray *r, unsigned int **run);
+bool	col_cache_insert(t_col_cache *c, t_ray *r, unsigned int **run);
 
 /* ************************************************************************** */
 /* Textures */
 
 bool	load_textures(t_cub3d *cub);
 t_img	*select_wall_texture(t_cub3d *cub, t_ray *r);
-int		calc_wall_tex_x(t_cub3d *cub, t_ray *r, t_img *tex);
+bool	init_anims(t_cub3d *cub);
+void	free_anims(t_cub3d *cub);
+t_img	*anim_frame(t_cub3d *cub, int i);
 
 /* ************************************************************************** */
 /* Movement */
@@ -126,5 +317,6 @@ void	move_left(t_cub3d *cub);
 void	move_right(t_cub3d *cub);
 void	rotate_right(t_cub3d *cub);
 void	rotate_left(t_cub3d *cub);
+void	look_up_down(t_cub3d *cub, bool up);
 
 #endif
\ No newline at end of file
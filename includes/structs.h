@@ -6,7 +6,7 @@
 /*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/21 09:31:48 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/12/03 18:43:50 by vjan-nie         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:42:20 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -24,6 +24,19 @@
 # define STRUCTS_H
 
 # include <stdbool.h>
+# include <stdint.h>
+
+# define TEX_FLOOR 4
+# define TEX_CEILING 5
+# define TEX_SKY 6
+# define TEX_SPRITE 7
+# define SPRITE_TYPES 3
+# define TEX_DOOR 10
+# define TEX_GRATE 11
+# define TEX_COUNT 12
+# define MAX_LIGHTS 16
+# define LIGHT_MAX_VALUE 65535
+# define MAX_DYN_LIGHTS 64
 
 /**
  * @enum e_keycode
@@ -35,7 +48,10 @@
  * @param KEY_D: Key code for 'D' (Strafe Right).
  * @param KEY_LEFT: Key code for the Left Arrow key (Rotate Left).
  * @param KEY_RIGHT: Key code for the Right Arrow key (Rotate Right).
+ * @param KEY_UP: Key code for the Up Arrow key (Look Up).
+ * @param KEY_DOWN: Key code for the Down Arrow key (Look Down).
  * @param KEY_ESC: Key code for the Escape key (Exit).
+ * @param KEY_E: Key code for the 'E' key (Open/Close the door in front).
  */
 typedef enum e_keycode
 {
@@ -45,9 +61,216 @@ typedef enum e_keycode
 	KEY_D = 100,
 	KEY_LEFT = 65361,
 	KEY_RIGHT = 65363,
-	KEY_ESC = 65307
+	KEY_UP = 65362,
+	KEY_DOWN = 65364,
+	KEY_ESC = 65307,
+	KEY_E = 101
 }	t_keycode;
 
+/**
+ * @struct s_occupancy
+ * @brief Bit-packed solidity grid of the map, one bit per tile.
+ * Walls are tested with a shift and a mask instead of a char comparison, and
+ * the whole grid is 1/8 of the char grid (a 4096x4096 map takes 2 MB).
+ * A second, coarser bitmap holds one bit per 8x8 block of tiles, set when the
+ * block contains at least one wall, so empty blocks are skipped in one test.
+ * @param cells: Tile bits, row-major, 64 tiles per word.
+ * @param blocks: 8x8 block bits, row-major, 64 blocks per word.
+ * @param stride: Number of words per row in `cells`.
+ * @param block_stride: Number of words per block row in `blocks`.
+ */
+typedef struct s_occupancy
+{
+	uint64_t	*cells;
+	uint64_t	*blocks;
+	int			stride;
+	int			block_stride;
+}				t_occupancy;
+
+/**
+ * @struct s_light
+ * @brief Static point light declared in the .cub file (L x,y,radius).
+ * @param x: World X of the light (center of its tile).
+ * @param y: World Y of the light.
+ * @param radius: Distance, in tiles, at which the light fades out.
+ */
+typedef struct s_light
+{
+	double	x;
+	double	y;
+	double	radius;
+}			t_light;
+
+/**
+ * @struct s_light_grid
+ * @brief Per-tile light of the moving (dynamic) lights.
+ * Each tile holds the sum of the contributions of every dynamic light that
+ * sees it. Moving a light subtracts its old contribution and adds the new
+ * one, touching only the tiles within its radius.
+ * @param level: Light per tile (width * height, 256 = full), or NULL while
+ * no dynamic light exists.
+ * @param lights: Dynamic lights, at the position last applied to `level`.
+ * @param count: Number of entries in `lights`.
+ * @param relit: Tiles recomputed so far (for statistics).
+ */
+typedef struct s_light_grid
+{
+	unsigned short	*level;
+	t_light			lights[MAX_DYN_LIGHTS];
+	int				count;
+	long			relit;
+}					t_light_grid;
+
+/**
+ * @struct s_sprite
+ * @brief An object standing on the floor, drawn as a billboard.
+ * @param x: World X of its center.
+ * @param y: World Y of its center.
+ * @param type: Object type (0 to SPRITE_TYPES - 1), from the map
+ * character ('2' + type); selects the texture TEX_SPRITE + type.
+ * @param dist: Squared distance to the player at the last frame, the key
+ * of the back-to-front order.
+ */
+typedef struct s_sprite
+{
+	double	x;
+	double	y;
+	double	dist;
+	int		type;
+}			t_sprite;
+
+/**
+ * @struct s_door
+ * @brief A door tile ('D'): a panel across the middle of the tile that
+ * slides sideways to open.
+ * The tile is solid (for rays, movement and the distance field) unless the
+ * door is fully open; rays entering it are tested against the panel.
+ * @param x: Column of the tile.
+ * @param y: Row of the tile.
+ * @param side: Orientation of the panel, like a ray side: 0 for the plane
+ * x = x + 0.5 (passage along X), 1 for y = y + 0.5 (passage along Y).
+ * @param open: How far the panel has slid (0 closed, 1 fully open); it
+ * covers [open, 1) across the tile.
+ * @param move: DOOR_SPEED steps per frame: +1 opening, -1 closing, 0 still.
+ */
+typedef struct s_door
+{
+	int		x;
+	int		y;
+	int		side;
+	double	open;
+	int		move;
+}			t_door;
+
+/**
+ * @struct s_layer
+ * @brief A face crossed by a ray on its way to the wall it stops on: a
+ * see-through one (grate or window tile, 'G') or a wall low enough to show
+ * what stands behind it. Layers are drawn over that wall, far to near.
+ * @param perp: Perpendicular distance to the face.
+ * @param wall_x: Where the ray crosses the face, 0 to 1 along it.
+ * @param height: Height of the face in tiles (1 for grates).
+ * @param map_x: X-coordinate of the tile.
+ * @param map_y: Y-coordinate of the tile.
+ * @param side: Face crossed (0 vertical, 1 horizontal), as in t_ray.
+ */
+typedef struct s_layer
+{
+	double	perp;
+	double	wall_x;
+	double	height;
+	int		map_x;
+	int		map_y;
+	int		side;
+}			t_layer;
+
+/**
+ * @struct s_fov_line
+ * @brief Line bounding a view of the field of view of a tile, from
+ * (xi, yi) to (xf, yf), in tile corners of the quadrant being scanned
+ * (the source tile spans (0, 0) to (1, 1)).
+ */
+typedef struct s_fov_line
+{
+	int	xi;
+	int	yi;
+	int	xf;
+	int	yf;
+}		t_fov_line;
+
+/**
+ * @struct s_fov_view
+ * @brief Wedge of a quadrant still in sight, between its shallow (closest
+ * to the x axis) and steep line.
+ * @param shallow: Lower bound of the wedge.
+ * @param steep: Upper bound of the wedge.
+ * @param shallow_bump: Last corner that bent the shallow line (index in
+ * the bumps of t_fov, -1 if none).
+ * @param steep_bump: Last corner that bent the steep line.
+ */
+typedef struct s_fov_view
+{
+	t_fov_line	shallow;
+	t_fov_line	steep;
+	int			shallow_bump;
+	int			steep_bump;
+}				t_fov_view;
+
+/**
+ * @struct s_fov_bump
+ * @brief Wall corner that bent a line of a view, chained to the previous
+ * corner that bent the same line.
+ */
+typedef struct s_fov_bump
+{
+	int	x;
+	int	y;
+	int	parent;
+}		t_fov_bump;
+
+/**
+ * @struct s_pvs
+ * @brief Potentially visible sets of the map: for every open tile, the
+ * tiles that can be seen from some point inside it.
+ * Each set is stored run-length encoded, as alternating lengths of unseen
+ * and seen tiles in row-major order starting with an unseen run. Only the
+ * set of the tile the player stands in is decoded, into `seen`, and only
+ * when the player enters another tile.
+ * @param runs: Run lengths of all the sets, one after the other.
+ * @param first: Index in `runs` of the set of each tile (width * height + 1
+ * entries, tile i spans first[i] to first[i + 1]; empty for walls).
+ * @param seen: Decoded set of `cell`, one bit per tile, row-major.
+ * @param cell: Tile whose set is in `seen`, -1 if none yet.
+ * @param count: Entries used in `runs`.
+ * @param size: Entries allocated in `runs`.
+ */
+typedef struct s_pvs
+{
+	unsigned short	*runs;
+	int				*first;
+	uint64_t		*seen;
+	int				cell;
+	int				count;
+	int				size;
+}					t_pvs;
+
+/**
+ * @struct s_anim
+ * @brief Animation of a wall texture, loaded as a vertical strip of frames.
+ * @param count: Number of frames in the strip (0 for a still texture).
+ * @param fps: Frames shown per second.
+ * @param views: For each frame, a view of it in the strip followed by a
+ * view of it in each shaded copy (count * (SHADE_LEVELS + 1) entries, NULL
+ * until the renderer starts). Views only point into the loaded strip and
+ * its shaded copies: no texel is copied.
+ */
+typedef struct s_anim
+{
+	int				count;
+	int				fps;
+	struct s_img	*views;
+}					t_anim;
+
 /**
  * @struct s_map
  * @brief Stores the configuration and data of the map loaded from
@@ -56,24 +279,106 @@ typedef enum e_keycode
  * read during the parsing phase.
  * @param grid: Map represented as a dynamically allocated grid
  * (matrix) of characters ('0' for floor, '1' for wall, 'N', 'S', 'E', 'W'
- * for player start position).
+ * for player start position). Sprite tiles are turned into '0' once their
+ * sprite is collected.
  * @param width: Width of the map in tiles (grid columns).
  * @param height: Height of the map in tiles (grid rows).
  * @param tex_paths: Array of strings containing the file paths for the
- * four cardinal textures (NO, SO, WE, EA).
+ * four cardinal textures (NO, SO, WE, EA), then the optional floor and
+ * ceiling textures (F/C given an .xpm path instead of a color), sky
+ * panorama (SKY) and sprite textures (S2, S3, S4).
  * @param floor_color: The R,G,B color value for the floor (F),
  * represented as a single integer.
  * @param ceiling_color: The R,G,B color value for the ceiling (C).
+ * @param version: Incremented every time a tile changes at runtime, so
+ * the ray hits kept from earlier frames (ray cache, interlaced rays) can
+ * tell they are stale. The column cache does not read it: its entries do
+ * not depend on the layout.
+ * @param dist: Distance field (width * height, row-major) holding, for every
+ * tile, the Chebyshev distance to the nearest wall ('1'), saturated at 255.
+ * Walls store 0. Built once after validation and used by the DDA to leap
+ * over empty space.
+ * @param solid: Bit-packed occupancy grid, built right after normalization
+ * and shared by the validator, the DDA and the collision checks.
+ * @param lights: Static lights declared in the file.
+ * @param light_count: Number of entries in `lights`.
+ * @param light: Baked lightmap, LIGHTMAP_RES brightness samples (0-255) per
+ * wall face bordering open space, packed (see light_of). NULL when the map
+ * declares no lights.
+ * @param light_of: Per tile, indexed like the grid: the index of its first
+ * face in `light`, shifted left by 4, with one bit per face that has
+ * samples (bit f for face f) in the low 4 bits.
+ * @param dyn: Light grid of the dynamic lights.
+ * @param sprites: Sprites collected from the grid, NULL if there are none.
+ * @param sprite_count: Number of entries in `sprites`.
+ * @param pvs: Potentially visible sets, `runs` NULL when not built.
+ * @param doors: Doors of the map, NULL if there are none.
+ * @param door_count: Number of entries in `doors`.
+ * @param door_of: Index in `doors` of the door of each tile (-1 for
+ * other tiles), NULL if there are no doors.
+ * @param grates: Number of grate tiles ('G').
+ * @param heights: Height of the wall of each tile in half tiles, indexed
+ * like the grid (2 for the standard height); NULL if the file has no
+ * HEIGHTS section.
+ * @param max_height: Tallest entry of `heights`.
+ * @param anims: Animations of the four wall textures.
  */
 typedef struct s_map
 {
-	char	**grid;
-	int		width;
-	int		height;
-	char	*tex_paths[4];
-	int		floor_color;
-	int		ceiling_color;
-}			t_map;
+	char			**grid;
+	int				width;
+	int				height;
+	char			*tex_paths[TEX_COUNT];
+	int				floor_color;
+	int				ceiling_color;
+	int				version;
+	unsigned char	*dist;
+	t_occupancy		solid;
+	t_light			lights[MAX_LIGHTS];
+	int				light_count;
+	unsigned char	*light;
+	int				*light_of;
+	t_light_grid	dyn;
+	t_sprite		*sprites;
+	int				sprite_count;
+	t_pvs			pvs;
+	t_door			*doors;
+	int				door_count;
+	int				*door_of;
+	int				grates;
+	unsigned char	*heights;
+	int				max_height;
+	t_anim			anims[4];
+}					t_map;
+
+/**
+ * @struct s_fov
+ * @brief State of the field of view of one tile (see pvs_fov.c).
+ * @param map: Map being scanned.
+ * @param seen: Set the visible tiles are marked in.
+ * @param views: Views of the quadrant, shallowest first (one more than the
+ * tiles of the map, since every split adds one).
+ * @param bumps: Corners of the quadrant (two per tile of the map).
+ * @param view_count: Views in use.
+ * @param bump_count: Corners in use.
+ * @param view: View the current tile is checked against.
+ * @param x, y: Source tile.
+ * @param dx, dy: Direction of the quadrant on both axes (1 or -1).
+ */
+typedef struct s_fov
+{
+	t_map		*map;
+	uint64_t	*seen;
+	t_fov_view	*views;
+	t_fov_bump	*bumps;
+	int			view_count;
+	int			bump_count;
+	int			view;
+	int			x;
+	int			y;
+	int			dx;
+	int			dy;
+}				t_fov;
 
 /**
  * @struct s_player
@@ -88,6 +393,9 @@ typedef struct s_map
  * @param plane_y: Y-component of the camera plane vector.
  * @param move_speed: Movement speed factor per frame.
  * @param rot_speed: Rotation speed factor per frame, in radians.
+ * @param pitch: Rows the horizon is moved down from the middle of the
+ * screen, positive when looking up. Looking up or down shears the view
+ * vertically instead of tilting the camera, so walls stay vertical.
  */
 typedef struct s_player
 {
@@ -99,6 +407,7 @@ typedef struct s_player
 	double	plane_y;
 	double	move_speed;
 	double	rot_speed;
+	int		pitch;
 }			t_player;
 
 /**
@@ -145,6 +454,8 @@ typedef struct s_img
  * @param d: State of the 'D' key (Strafe Right).
  * @param left: State of the Left Arrow key (Rotate Left).
  * @param right: State of the Right Arrow key (Rotate Right).
+ * @param up: State of the Up Arrow key (Look Up).
+ * @param down: State of the Down Arrow key (Look Down).
  * @param esc: State of the 'ESC' key (Exit/Close window).
  */
 typedef struct s_input
@@ -155,37 +466,54 @@ typedef struct s_input
 	bool	d;
 	bool	left;
 	bool	right;
+	bool	up;
+	bool	down;
 	bool	esc;
 }			t_input;
 
 /**
- * @struct s_cub3d
- * @brief The main context structure for the entire application.
- * This structure aggregates all essential data structures and MiniLibX
- * handlers, serving as the central hub of the game state. This structure
- * is typically passed around to functions that need access to the global state.
- * @param mlx: MiniLibX connection handler.
- * @param win: MiniLibX window pointer.
- * @param map: Map and configuration data.
- * @param player: Player/camera state.
- * @param frame: Main framebuffer image.
- * @param textures[4]: Array of texture images (NO, SO, WE, EA).
- * @param screen_width: Window width in pixels.
- * @param screen_height: Window height in pixels.
- * @param key_code: Current state of keyboard inputs.
+ * @struct s_hit_entry
+ * @brief One slot of the angular ray-hit cache: the exact direction of a ray
+ * cast from the cached position and the wall face it hit.
+ * @param angle: Ray direction, as returned by atan2 (radians, -PI..PI).
+ * @param map_x: X-coordinate of the hit tile.
+ * @param map_y: Y-coordinate of the hit tile.
+ * @param side: Side of the hit (0 for vertical line, 1 for horizontal).
+ * @param stamp: Generation the entry belongs to; it is only valid while it
+ * equals the cache's current stamp.
  */
-typedef struct s_cub3d
+typedef struct s_hit_entry
 {
-	void		*mlx;
-	void		*win;
-	t_map		map;
-	t_player	player;
-	t_img		frame;
-	t_img		textures[4];
-	int			screen_width;
-	int			screen_height;
-	t_input		key_code;
-}	t_cub3d;
+	double	angle;
+	int		map_x;
+	int		map_y;
+	int		side;
+	int		stamp;
+}			t_hit_entry;
+
+/**
+ * @struct s_ray_cache
+ * @brief Angular cache of ray hits for the current player position.
+ * While the player only rotates, every hit is a function of the ray angle
+ * alone, so hits found on previous frames are reused instead of running the
+ * DDA again. Moving or changing the map bumps `stamp`, which invalidates all
+ * entries at once.
+ * @param entries: RAY_CACHE_SIZE slots indexed by quantized angle.
+ * @param pos_x: Player X-position the entries were computed for.
+ * @param pos_y: Player Y-position the entries were computed for.
+ * @param angle: Angle of the last ray looked up (reused when storing it).
+ * @param stamp: Current generation.
+ * @param map_version: Map version the entries were computed for.
+ */
+typedef struct s_ray_cache
+{
+	t_hit_entry	*entries;
+	double		pos_x;
+	double		pos_y;
+	double		angle;
+	int			stamp;
+	int			map_version;
+}				t_ray_cache;
 
 /**
  * @struct s_ray
@@ -197,8 +525,9 @@ typedef struct s_cub3d
  * @details
  * The Digital Differential Analyzer (DDA) algorithm is used to efficiently
  * traverse the map grid, checking which tiles the ray intersects without
- * heavy trigonometric calculations at every step. This structure is typically
- * initialized and reused within the main rendering loop for each screen column.
+ * heavy trigonometric calculations at every step. One instance per screen
+ * column is kept in `t_cub3d::rays`: the rays are all cast first, then the
+ * walls are drawn span by span from that buffer.
  * @param dir_x: X-component of the ray's direction vector.
  * @param dir_y: Y-component of the ray's direction vector.
  * @param side_x: Distance from the ray's origin to the next vertical
@@ -219,11 +548,24 @@ typedef struct s_cub3d
  * (0 for vertical line hit, 1 for horizontal line hit).
  * @param hit: Flag (1) if the ray has hit a wall, (0) otherwise.
  * @param line_h: Height of the projected wall slice in pixels.
+ * @param mid: Row the projected wall line is centred on (the horizon).
  * @param start: Starting pixel (Y-coordinate) on the screen where the
  * projected wall line begins.
  * @param end: Ending pixel (Y-coordinate) on the screen where the projected
  * wall line ends.
  * @param color: Final color of the pixel.
+ * @param tex_x: X-coordinate of the texture column mapped to this ray.
+ * @param tex: Texture of the hit face.
+ * @param door: Index of the door whose panel was hit, -1 for walls.
+ * @param transient: Set when the ray entered a door or grate tile, or went
+ * past a wall, so its hit depends on more than the face it stopped on and
+ * must not be cached.
+ * @param layer: MAX_LAYERS slots of its column in `t_cub3d::layers`
+ * (NULL on maps without grates or wall heights).
+ * @param layers: Faces crossed before the hit and stored in `layer`,
+ * nearest first; counted down as they are drawn.
+ * @param clip: Highest screen row reached so far by the walls the ray went
+ * past (screen_height when there are none).
  */
 typedef struct s_ray
 {
@@ -241,9 +583,376 @@ typedef struct s_ray
 	int		side;
 	int		hit;
 	int		line_h;
+	int		mid;
 	int		start;
 	int		end;
 	int		color;
+	int		tex_x;
+	t_img	*tex;
+	int		door;
+	bool	transient;
+	t_layer	*layer;
+	int		layers;
+	double	clip;
 }			t_ray;
 
+/**
+ * @struct s_span
+ * @brief Constants shared by a run of adjacent columns whose rays hit the
+ * same face of the same tile.
+ * Along a flat face, the inverse perpendicular distance is the ray direction
+ * component across the face times a constant, so each column of the span
+ * gets its distance, wall height and texture column with a couple of
+ * multiplies instead of re-deriving everything from scratch.
+ * @param tex: Texture of the face, selected once per span.
+ * @param inv_depth: 1 / (signed distance from the player to the face
+ * plane), measured along the axis perpendicular to the face.
+ * @param origin: Player coordinate along the face axis.
+ * @param flip: Whether the texture column must be mirrored for this face.
+ * @param height: Height of the face in tiles.
+ */
+typedef struct s_span
+{
+	t_img	*tex;
+	double	inv_depth;
+	double	origin;
+	bool	flip;
+	double	height;
+}			t_span;
+
+/**
+ * @struct s_scan
+ * @brief World position of a floor/ceiling scanline, walked pixel by pixel.
+ * Only the position inside the tile matters to pick a texel, so coordinates
+ * keep just their fractional part, as 0.32 fixed point: unsigned overflow
+ * is exactly the wrap from one tile to the next.
+ * @param x: Fraction of the world X of the current pixel.
+ * @param y: Fraction of the world Y of the current pixel.
+ * @param step_x: X advance per screen pixel.
+ * @param step_y: Y advance per screen pixel.
+ */
+typedef struct s_scan
+{
+	uint32_t	x;
+	uint32_t	y;
+	uint32_t	step_x;
+	uint32_t	step_y;
+}				t_scan;
+
+/**
+ * @struct s_col_entry
+ * @brief One pre-scaled wall column: the visible pixels of texture column
+ * `tex_x` of `tex` stretched to a wall line `line_h` pixels high.
+ * The pixel run is allocated together with the entry, right after it.
+ * @param pixels: `len` texels, top to bottom, ready to copy to the frame.
+ * @param tex: Texture the column was scaled from.
+ * @param tex_x: Texture column.
+ * @param line_h: Projected wall height the column was scaled to.
+ * @param len: Number of visible pixels (end - start + 1).
+ * @param next: Next entry in the same hash bucket.
+ * @param newer: Neighbour towards the most recently used entry.
+ * @param older: Neighbour towards the least recently used entry.
+ */
+typedef struct s_col_entry
+{
+	unsigned int		*pixels;
+	t_img				*tex;
+	int					tex_x;
+	int					line_h;
+	int					len;
+	struct s_col_entry	*next;
+	struct s_col_entry	*newer;
+	struct s_col_entry	*older;
+}						t_col_entry;
+
+/**
+ * @struct s_col_cache
+ * @brief LRU cache of pre-scaled wall columns, bounded by a memory budget.
+ * The same (texture, tex_x, line_h) triple is drawn many times per frame and
+ * across frames; on a hit the column is a plain copy instead of a texture
+ * walk. When the budget is exceeded, least recently used entries are freed.
+ * The budget is COLUMN_CACHE_BUDGET and defaults to 0 (disabled): with the
+ * fixed-point scaling kernel a strided copy costs about as much as the
+ * texture walk it replaces. Build with -DCOLUMN_CACHE_BUDGET=<bytes> to
+ * enable it once the per-pixel work grows.
+ * @param buckets: COLUMN_CACHE_BUCKETS hash chains.
+ * @param newest: Most recently used entry (head of the LRU list).
+ * @param oldest: Least recently used entry (tail of the LRU list).
+ * @param used: Bytes currently allocated (entries and pixels).
+ * @param budget: Maximum bytes the cache may hold (0 disables it).
+ * @param hits: Lookups served from the cache.
+ * @param misses: Lookups that had to scale the column.
+ * @param evictions: Entries freed to stay within the budget.
+ */
+typedef struct s_col_cache
+{
+	t_col_entry	**buckets;
+	t_col_entry	*newest;
+	t_col_entry	*oldest;
+	size_t		used;
+	size_t		budget;
+	long		hits;
+	long		misses;
+	long		evictions;
+}				t_col_cache;
+
+/**
+ * @struct s_dda_f
+ * @brief Single-precision traversal state of the float DDA kernel
+ * (DDA_PRECISION == DDA_FLOAT); tile and steps stay in the t_ray.
+ * @param side_x: Distance to the next vertical grid line.
+ * @param side_y: Distance to the next horizontal grid line.
+ * @param delta_x: Distance between two vertical grid lines.
+ * @param delta_y: Distance between two horizontal grid lines.
+ * @param travel: Distance removed from the side distances by rebasing.
+ */
+typedef struct s_dda_f
+{
+	float	side_x;
+	float	side_y;
+	float	delta_x;
+	float	delta_y;
+	float	travel;
+}			t_dda_f;
+
+/**
+ * @struct s_dda_x
+ * @brief Fixed-point traversal state of the 16.16 DDA kernel
+ * (DDA_PRECISION == DDA_FIXED). Values have 16 fractional bits; 64-bit
+ * storage keeps the accumulated distances from overflowing on large maps.
+ * @param side_x: Distance to the next vertical grid line.
+ * @param side_y: Distance to the next horizontal grid line.
+ * @param delta_x: Distance between two vertical grid lines.
+ * @param delta_y: Distance between two horizontal grid lines.
+ */
+typedef struct s_dda_x
+{
+	int64_t	side_x;
+	int64_t	side_y;
+	int64_t	delta_x;
+	int64_t	delta_y;
+}			t_dda_x;
+
+/**
+ * @struct s_camera
+ * @brief Per-column camera ray tables.
+ * The camera-plane offset of every column only depends on the resolution
+ * (and on the foveated grouping), so it is computed once. Ray directions
+ * and DDA deltas are then derived for the whole screen in a single sweep
+ * per frame, which the compiler can vectorize.
+ * All five arrays live in one allocation of 5 * width doubles.
+ * @param offset: Camera-plane offset of each column, in [-1, 1].
+ * @param dir_x: X component of each column's ray direction.
+ * @param dir_y: Y component of each column's ray direction.
+ * @param delta_x: Ray length between two vertical grid lines.
+ * @param delta_y: Ray length between two horizontal grid lines.
+ * @param width: Number of columns the tables were built for.
+ */
+typedef struct s_camera
+{
+	double	*offset;
+	double	*dir_x;
+	double	*dir_y;
+	double	*delta_x;
+	double	*delta_y;
+	int		width;
+}			t_camera;
+
+/**
+ * @struct s_interlace
+ * @brief State of the interlaced rendering mode (INTERLACED=1).
+ * Every frame casts the columns of one parity only; the other ones are
+ * reconstructed from the hits of the previous frame and of their freshly
+ * cast neighbours. Pose and map version of the previous frame decide
+ * whether that is allowed or the whole frame must be cast.
+ * @param pos_x: Player X position at the previous frame.
+ * @param pos_y: Player Y position at the previous frame.
+ * @param angle: Player view angle at the previous frame.
+ * @param map_version: `t_map::version` at the previous frame.
+ * @param parity: Parity of the columns cast this frame.
+ * @param full: True if every column is cast this frame.
+ * @param primed: True once a first frame has been rendered.
+ */
+typedef struct s_interlace
+{
+	double	pos_x;
+	double	pos_y;
+	double	angle;
+	int		map_version;
+	int		parity;
+	bool	full;
+	bool	primed;
+}			t_interlace;
+
+/**
+ * @struct s_tex_run
+ * @brief A vertical run of opaque texels in one column of a sprite texture.
+ * @param start: First texture row of the run.
+ * @param len: Number of texels.
+ * @param offset: Index of its first texel in `t_sprite_runs::texels`.
+ */
+typedef struct s_tex_run
+{
+	unsigned short	start;
+	unsigned short	len;
+	unsigned int	offset;
+}					t_tex_run;
+
+/**
+ * @struct s_sprite_runs
+ * @brief Sprite texture stored as opaque runs only (SPRITE_RLE builds).
+ * Transparent texels are dropped at load time, so drawing a column copies
+ * whole runs without testing every texel.
+ * @param first: Index in `runs` of the first run of each texture column
+ * (width + 1 entries, the last one is the total).
+ * @param runs: Runs of all columns, column by column, top to bottom.
+ * @param texels: Opaque texels, packed column by column.
+ * @param bytes: Memory used by the three arrays.
+ */
+typedef struct s_sprite_runs
+{
+	int				*first;
+	t_tex_run		*runs;
+	unsigned int	*texels;
+	long			bytes;
+}					t_sprite_runs;
+
+/**
+ * @struct s_sprite_view
+ * @brief A sprite that passed culling, projected for the current frame.
+ * @param depth: Distance along the view direction, comparable with the
+ * `perp` of the wall rays.
+ * @param left: Screen column of its left edge (may be off screen).
+ * @param width: Width on screen, in pixels.
+ * @param height: Height on screen, in pixels.
+ * @param step: Texture rows per screen row, in 16.16 fixed point.
+ * @param fog: Fog weight at its depth (0 without fog).
+ * @param top: Screen row of its top edge (may be off screen).
+ * @param tex: Texture of its type.
+ * @param runs: Opaque runs of that texture, NULL without SPRITE_RLE.
+ */
+typedef struct s_sprite_view
+{
+	double			depth;
+	int				left;
+	int				width;
+	int				height;
+	int				step;
+	int				fog;
+	int				top;
+	t_img			*tex;
+	t_sprite_runs	*runs;
+}					t_sprite_view;
+
+/**
+ * @struct s_render_stats
+ * @brief Counters printed on exit by RENDER_STATS builds.
+ * @param frames: Frames rendered.
+ * @param rays: Rays traced (ray cache lookups and full DDA walks).
+ * @param reconstructed: Columns filled in without tracing a ray.
+ * @param mismatches: Reconstructed columns whose face differs from the
+ * one a traced ray would have hit (only checked by RENDER_STATS builds).
+ * @param diff_pixels: Pixels of those columns that may differ from a full
+ * cast (the rows of the taller of both wall lines).
+ * @param frame_diff: diff_pixels of the frame being rendered.
+ * @param worst_diff: Largest frame_diff of the frames already rendered.
+ * @param sprites: Sprites drawn (after culling).
+ * @param hidden: Sprites skipped because they are outside the player's
+ * potentially visible set.
+ * @param layers: Layers stored by the rays, to be composited.
+ * @param capped: Rays stopped because MAX_LAYERS layers were stored.
+ * @param opaque: Rays stopped on a grate column without transparent texels.
+ * @param walls: Walls the rays went past, drawn as layers.
+ */
+typedef struct s_render_stats
+{
+	long	frames;
+	long	rays;
+	long	reconstructed;
+	long	mismatches;
+	long	diff_pixels;
+	long	frame_diff;
+	long	worst_diff;
+	long	sprites;
+	long	hidden;
+	long	layers;
+	long	capped;
+	long	opaque;
+	long	walls;
+}			t_render_stats;
+
+/**
+ * @struct s_cub3d
+ * @brief The main context structure for the entire application.
+ * This structure aggregates all essential data structures and MiniLibX
+ * handlers, serving as the central hub of the game state. This structure
+ * is typically passed around to functions that need access to the global state.
+ * @param mlx: MiniLibX connection handler.
+ * @param win: MiniLibX window pointer.
+ * @param map: Map and configuration data.
+ * @param player: Player/camera state.
+ * @param frame: Main framebuffer image.
+ * @param textures: Texture images (NO, SO, WE, EA, then the optional
+ * floor, ceiling, sky and sprite textures, loaded only when given).
+ * @param screen_width: Window width in pixels.
+ * @param screen_height: Window height in pixels.
+ * @param key_code: Current state of keyboard inputs.
+ * @param ray_cache: Angular ray-hit cache used while the player rotates
+ * in place.
+ * @param rays: Per-column ray buffer (screen_width entries) filled by the
+ * cast pass of every frame.
+ * @param col_cache: Cache of pre-scaled wall columns.
+ * @param camera: Per-column camera ray tables.
+ * @param dda_precision: DDA kernel in use: DDA_PRECISION, or DDA_DOUBLE if
+ * the map is too large for it.
+ * @param fog_lut: Fog weight per projected wall height (VIEW_DISTANCE).
+ * @param shades: Pre-shaded copies of the wall textures, SHADE_LEVELS per
+ * texture (SHADING builds only).
+ * @param sky_u: Panorama column seen by each screen column this frame, or
+ * NULL without a SKY texture.
+ * @param views: Sprites projected this frame, far to near
+ * (`map.sprite_count` entries allocated).
+ * @param sprite_order: Indices of all the sprites of the map, far to near
+ * as of the last frame; re-sorted every frame from that order.
+ * @param view_count: Number of sprites in `views` this frame.
+ * @param sprite_runs: Opaque runs of each sprite texture (SPRITE_RLE).
+ * @param layers: Layers of every column, MAX_LAYERS per column (NULL on
+ * maps without grates or wall heights).
+ * @param grate_opaque: For each column of the grate texture, whether it
+ * has no transparent texel.
+ * @param interlace: State of the interlaced rendering mode.
+ * @param stats: Render counters reported by RENDER_STATS builds.
+ * @param clock: Frames rendered since start-up; drives the animated
+ * textures.
+ */
+typedef struct s_cub3d
+{
+	void			*mlx;
+	void			*win;
+	t_map			map;
+	t_player		player;
+	t_img			frame;
+	t_img			textures[TEX_COUNT];
+	int				screen_width;
+	int				screen_height;
+	t_input			key_code;
+	t_ray_cache		ray_cache;
+	t_ray			*rays;
+	t_col_cache		col_cache;
+	t_camera		camera;
+	int				dda_precision;
+	unsigned short	*fog_lut;
+	t_img			*shades;
+	int				*sky_u;
+	t_sprite_view	*views;
+	int				*sprite_order;
+	int				view_count;
+	t_sprite_runs	sprite_runs[SPRITE_TYPES];
+	t_layer			*layers;
+	bool			*grate_opaque;
+	t_interlace		interlace;
+	t_render_stats	stats;
+	long			clock;
+}	t_cub3d;
+
 #endif
\ No newline at end of file
@@ -6,7 +6,7 @@
 /*   By: sergio-jimenez <sergio-jimenez@student.    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/27 01:20:38 by sergio-jime       #+#    #+#             */
-/*   Updated: 2025/11/27 02:37:02 by sergio-jime      ###   ########.fr       */
+/*   Updated: 2026/10/18 00:34:47 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -38,7 +38,8 @@ static void	clean_mlx(t_cub3d *cub)
 }
 
 /**
- * @brief Destroys all four texture images (NO, SO, WE, EA) if they were loaded.
+ * @brief Destroys all texture images (NO, SO, WE, EA, floor, ceiling) that
+ * were loaded.
  * Iterates through the `cub->textures` array and destroys any valid image
  * pointer using `mlx_destroy_image`.
  * @param cub Pointer to the main t_cub3d context structure.
@@ -51,7 +52,7 @@ static void	clean_textures(t_cub3d *cub)
 	i = 0;
 	if (cub->mlx)
 	{
-		while (i < 4)
+		while (i < TEX_COUNT)
 		{
 			if (cub->textures[i].img_ptr)
 			{
@@ -99,7 +100,7 @@ static void	clean_frame(t_cub3d *cub)
  * @brief Orchestrates the entire program cleanup process.
  * Calls specialized static functions to clean MLX resources in the
  * correct order (images/window first, then MLX connection), followed
- * by freeing the map's memory.
+ * by freeing the map's memory and the render buffers.
  * This function is called by `cleanup_and_exit` just before
  * program termination.
  * @param cub Pointer to the main t_cub3d context structure.
@@ -114,5 +115,6 @@ void	cleanup(t_cub3d *cub)
 	clean_window(cub);
 	clean_textures(cub);
 	free_map(&cub->map);
+	free_renderer(cub);
 	clean_mlx(cub);
 }
@@ -6,7 +6,7 @@
 /*   By: sergio-jimenez <sergio-jimenez@student.    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/20 11:56:53 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/11/27 02:24:51 by sergio-jime      ###   ########.fr       */
+/*   Updated: 2026/10/18 23:32:47 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -74,6 +74,7 @@ static int	init_graphics(t_cub3d *cub)
  * 2) Initialize window/framebuffer.
  * 3) Load textures.
  * 4) Initialize player.
+ * 5) Allocate the render buffers (ray buffer, ray-hit cache).
  */
 static bool	load_game(t_cub3d *cub, const char *path)
 {
@@ -84,6 +85,8 @@ static bool	load_game(t_cub3d *cub, const char *path)
 	if (!load_textures(cub))
 		return (false);
 	init_player(&cub->player, &cub->map);
+	if (!init_renderer(cub))
+		return (false);
 	return (true);
 }
 
@@ -6,7 +6,7 @@
 /*   By: sergio-jimenez <sergio-jimenez@student.    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/23 17:07:54 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/11/27 02:24:20 by sergio-jime      ###   ########.fr       */
+/*   Updated: 2026/10/19 01:53:25 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -44,6 +44,10 @@ static void	set_key_state(t_input *keys, int key, bool state)
 		keys->left = state;
 	else if (key == KEY_RIGHT)
 		keys->right = state;
+	else if (key == KEY_UP)
+		keys->up = state;
+	else if (key == KEY_DOWN)
+		keys->down = state;
 	else if (key == KEY_ESC)
 		keys->esc = state;
 }
@@ -53,13 +57,15 @@ static void	set_key_state(t_input *keys, int key, bool state)
  * This function marks the corresponding key flag in the t_input
  * structure as 'true'.
  * The actual player movement is deferred to the update_player() function in
- * the main loop.
+ * the main loop. The use key ('E') acts at once on the door in front.
  * @param keycode The integer code of the pressed key.
  * @param cub Pointer to the main t_cub3d context structure.
  * @return int Always returns 0.
  */
 int	on_key_press(int keycode, t_cub3d *cub)
 {
+	if (keycode == KEY_E)
+		toggle_door(cub);
 	set_key_state(&cub->key_code, keycode, true);
 	return (0);
 }
@@ -6,7 +6,7 @@
 /*   By: sergio-jimenez <sergio-jimenez@student.    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/18 16:40:43 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/11/27 02:34:31 by sergio-jime      ###   ########.fr       */
+/*   Updated: 2026/10/18 23:42:30 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -41,6 +41,8 @@ void	ft_error(char *msg)
  */
 int	close_window(t_cub3d *cub)
 {
+	if (RENDER_STATS)
+		print_render_stats(cub);
 	cleanup_and_exit(cub, 0);
 	return (0);
 }
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   distance_field.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:02:14 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/18 23:25:07 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file distance_field.c
+ * @brief Builds the per-tile distance-to-wall field used by the raycaster
+ * to skip empty space.
+ * For every tile the field stores the Chebyshev (chessboard) distance to the
+ * nearest wall. A tile with distance d guarantees that every tile at most
+ * d - 1 steps away on both axes is empty, so a ray standing in it can cross
+ * that whole square without testing the map.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Reads the distance currently stored for a tile.
+ * Anything outside the grid is treated as a wall (distance 0).
+ * @param map Pointer to the t_map structure.
+ * @param x The column index of the tile.
+ * @param y The row index of the tile.
+ * @return int The stored distance, or 0 outside the grid.
+ */
+static int	dist_at(t_map *map, int x, int y)
+{
+	if (x < 0 || y < 0 || x >= map->width || y >= map->height)
+		return (0);
+	return (map->dist[y * map->width + x]);
+}
+
+/**
+ * @brief Lowers the distance of a tile to one more than the distance of a
+ * neighbour, if that is smaller.
+ * @param map Pointer to the t_map structure.
+ * @param x The column index of the tile.
+ * @param y The row index of the tile.
+ * @param near The distance stored in the neighbouring tile.
+ */
+static void	relax(t_map *map, int x, int y, int near)
+{
+	unsigned char	*cell;
+
+	cell = &map->dist[y * map->width + x];
+	if (near + 1 < *cell)
+		*cell = near + 1;
+}
+
+/**
+ * @brief First raster pass (top-left to bottom-right).
+ * Propagates distances from the already visited neighbours: W, NW, N, NE.
+ * @param map Pointer to the t_map structure.
+ */
+static void	forward_pass(t_map *map)
+{
+	int	x;
+	int	y;
+
+	y = 0;
+	while (y < map->height)
+	{
+		x = 0;
+		while (x < map->width)
+		{
+			relax(map, x, y, dist_at(map, x - 1, y));
+			relax(map, x, y, dist_at(map, x - 1, y - 1));
+			relax(map, x, y, dist_at(map, x, y - 1));
+			relax(map, x, y, dist_at(map, x + 1, y - 1));
+			x++;
+		}
+		y++;
+	}
+}
+
+/**
+ * @brief Second raster pass (bottom-right to top-left).
+ * Propagates distances from the remaining neighbours: E, SE, S, SW.
+ * After both passes every tile holds its exact Chebyshev distance.
+ * @param map Pointer to the t_map structure.
+ */
+static void	backward_pass(t_map *map)
+{
+	int	x;
+	int	y;
+
+	y = map->height - 1;
+	while (y >= 0)
+	{
+		x = map->width - 1;
+		while (x >= 0)
+		{
+			relax(map, x, y, dist_at(map, x + 1, y));
+			relax(map, x, y, dist_at(map, x + 1, y + 1));
+			relax(map, x, y, dist_at(map, x, y + 1));
+			relax(map, x, y, dist_at(map, x - 1, y + 1));
+			x--;
+		}
+		y--;
+	}
+}
+
+/**
+ * @brief Allocates and computes the distance field of a validated map.
+ * Walls (read from the occupancy grid) start at 0 and every other tile at 255 (the saturation value), then
+ * two raster passes of a 3x3 chamfer mask give the exact chessboard distance.
+ * @param map Pointer to the validated and normalized t_map structure.
+ * @return bool True on success, false on allocation failure.
+ * @note The field is freed by `free_map`.
+ */
+bool	build_distance_field(t_map *map)
+{
+	int	i;
+
+	map->dist = malloc(map->width * map->height);
+	if (!map->dist)
+		return (ft_error("Malloc failed\n"), false);
+	i = 0;
+	while (i < map->width * map->height)
+	{
+		map->dist[i] = 255;
+		if (is_solid(map, i % map->width, i / map->width))
+			map->dist[i] = 0;
+		i++;
+	}
+	forward_pass(map);
+	backward_pass(map);
+	return (true);
+}
@@ -0,0 +1,190 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lightmap.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:20:48 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:31:25 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file lightmap.c
+ * @brief Load-time baking of static lights and ambient occlusion into a
+ * per-face lightmap.
+ * Every wall face bordering open space gets LIGHTMAP_RES brightness samples
+ * along its width: ambient light, plus each visible light in range (Lambert
+ * term times a quadratic falloff), darkened near inner corners where a
+ * perpendicular wall meets the face. Faces are numbered like the DDA sees
+ * them: side * 2 + (step > 0), i.e. 0 east, 1 west, 2 south, 3 north.
+ * Only those faces are stored, packed one after the other in grid order;
+ * a per-tile index (t_map::light_of) finds them. The map then takes
+ * LIGHTMAP_RES bytes per exposed face plus 4 bytes per tile.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Tells whether the segment from a point to a light crosses no wall,
+ * sampling it every 1/16 of a tile.
+ * @param map Pointer to the t_map structure.
+ * @param l Light.
+ * @param px World X of the point.
+ * @param py World Y of the point.
+ * @return bool True if the light reaches the point.
+ */
+static bool	light_visible(t_map *map, t_light *l, double px, double py)
+{
+	double	dx;
+	double	dy;
+	int		n;
+	int		i;
+
+	dx = l->x - px;
+	dy = l->y - py;
+	n = (int)(sqrt(dx * dx + dy * dy) * 16) + 1;
+	i = 1;
+	while (i < n)
+	{
+		if (is_solid(map, (int)(px + dx * i / n), (int)(py + dy * i / n)))
+			return (false);
+		i++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Brightness (0-1) of a point of a face, from ambient light and
+ * every light that reaches it.
+ * @param map Pointer to the t_map structure.
+ * @param p World position of the point, just off the face.
+ * @param n Face normal (n[0], n[1]).
+ * @return double Brightness before ambient occlusion.
+ */
+static double	light_at(t_map *map, double *p, int *n)
+{
+	double	sum;
+	double	dx;
+	double	dy;
+	double	d;
+	int		i;
+
+	sum = 0;
+	i = 0;
+	while (i < map->light_count)
+	{
+		dx = map->lights[i].x - p[0];
+		dy = map->lights[i].y - p[1];
+		d = sqrt(dx * dx + dy * dy);
+		if (d < map->lights[i].radius
+			&& light_visible(map, &map->lights[i], p[0], p[1]))
+			sum += fmax(0, (dx * n[0] + dy * n[1]) / fmax(d, 1e-6))
+				* pow(1 - d / map->lights[i].radius, 2);
+		i++;
+	}
+	return (LIGHT_AMBIENT + (1 - LIGHT_AMBIENT) * fmin(sum, 1));
+}
+
+/**
+ * @brief Bakes the samples of face `f` of tile (x, y), which borders open
+ * space. n holds the normal, then whether each end of the face is an inner
+ * corner (a wall on the open side next to it), which darkens that end.
+ * @param map Pointer to the t_map structure.
+ * @param x Tile X.
+ * @param y Tile Y.
+ * @param f Face index.
+ */
+static void	bake_face(t_map *map, int x, int y, int f)
+{
+	double			p[2];
+	int				n[4];
+	double			t;
+	int				i;
+	unsigned char	*out;
+
+	n[0] = (f == 0) - (f == 1);
+	n[1] = (f == 2) - (f == 3);
+	n[2] = is_solid(map, x + n[0] - (f >= 2), y + n[1] - (f < 2));
+	n[3] = is_solid(map, x + n[0] + (f >= 2), y + n[1] + (f < 2));
+	out = face_samples(map, x, y, f);
+	i = 0;
+	while (i < LIGHTMAP_RES)
+	{
+		t = (i + 0.5) / LIGHTMAP_RES;
+		p[0] = x + 0.5 + n[0] * 0.501 + (f >= 2) * (t - 0.5);
+		p[1] = y + 0.5 + n[1] * 0.501 + (f < 2) * (t - 0.5);
+		out[i] = (unsigned char)(255 * light_at(map, p, n) * (1 - AO_STRENGTH
+					* (n[2] * fmax(0, 1 - t / AO_RADIUS)
+						+ n[3] * fmax(0, 1 - (1 - t) / AO_RADIUS))));
+		i++;
+	}
+}
+
+/**
+ * @brief Numbers the faces bordering open space in grid order, filling
+ * `map->light_of`.
+ * @param map Pointer to the t_map structure, with `light_of` allocated.
+ * @return long Number of such faces.
+ */
+static long	index_faces(t_map *map)
+{
+	long	count;
+	long	i;
+	int		mask;
+	int		f;
+
+	count = 0;
+	i = 0;
+	while (i < (long)map->width * map->height)
+	{
+		mask = 0;
+		f = 0;
+		while (is_solid(map, i % map->width, i / map->width) && f < 4)
+		{
+			if (!is_solid(map, i % map->width + (f == 0) - (f == 1),
+					i / map->width + (f == 2) - (f == 3)))
+				mask |= 1 << f;
+			f++;
+		}
+		map->light_of[i++] = count << 4 | mask;
+		count += (mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1)
+			+ (mask >> 3);
+	}
+	return (count);
+}
+
+/**
+ * @brief Bakes the lightmap of every wall face bordering open space. Runs
+ * once after validation; does nothing when the map declares no lights.
+ * @param map Pointer to the t_map structure.
+ * @return bool True on success, false on invalid light or malloc failure.
+ */
+bool	bake_lightmaps(t_map *map)
+{
+	long	i;
+	int		f;
+
+	if (map->light_count == 0)
+		return (true);
+	if (!check_lights(map))
+		return (false);
+	map->light_of = malloc((long)map->width * map->height * sizeof(int));
+	if (map->light_of)
+		map->light = malloc((index_faces(map) + 1) * LIGHTMAP_RES);
+	if (!map->light)
+		return (ft_error("Malloc failed\n"), false);
+	i = 0;
+	while (i < (long)map->width * map->height)
+	{
+		f = 0;
+		while (f < 4)
+		{
+			if ((map->light_of[i] >> f) & 1)
+				bake_face(map, i % map->width, i / map->width, f);
+			f++;
+		}
+		i++;
+	}
+	return (true);
+}
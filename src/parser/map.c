@@ -6,7 +6,7 @@
 /*   By: sergio-jimenez <sergio-jimenez@student.    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/18 16:47:11 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/11/29 17:39:36 by sergio-jime      ###   ########.fr       */
+/*   Updated: 2026/10/19 02:20:43 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -52,8 +52,10 @@ static bool	check_map_aux(int i, int start, const char *joined)
  * Iterates through the raw content from the point where the map
  * started (`start`).
  * It ensures that every line found after the map begins contains at least
- * one valid map character ('0', '1', 'N', 'S', 'E', 'W', ' '). Empty lines
- * are forbidden between the first and last line of the map block.
+ * one valid map character ('0', '1', 'N', 'S', 'E', 'W', sprites, ' ').
+ * Empty lines are forbidden between the first and last line of the map block.
+ * They are forbidden in the HEIGHTS section too, if any, whose rows follow
+ * the map rows one to one, but its rows have their own characters.
  * @param joined The single string containing the entire file content.
  * @param start The index in `joined` where the map block begins.
  * @return bool True if the map block has no empty lines, false and prints
@@ -63,16 +65,20 @@ static bool	check_map_block(const char *joined, int start)
 {
 	int		i;
 	int		line_start;
-	bool	has_tile;
+	bool	heights;
 
 	i = start;
 	line_start = start;
+	heights = false;
 	while (joined[i])
 	{
 		if (joined[i] == '\n' || joined[i + 1] == '\0')
 		{
-			has_tile = check_map_aux(i, line_start, joined);
-			if (!has_tile)
+			if (is_heights_line(joined + line_start))
+				heights = true;
+			else if (heights && joined[i] == '\n' && i == line_start)
+				return (ft_error("Empty line in the HEIGHTS section\n"), false);
+			else if (!heights && !check_map_aux(i, line_start, joined))
 				return (ft_error("Empty lines inside map\n"), false);
 			line_start = i + 1;
 		}
@@ -104,8 +110,7 @@ static	char	*accumulate_gnl(int fd, char *joined)
 	line = get_next_line(fd);
 	while (line != NULL)
 	{
-		if (map_start == -1 && !is_texture_line(line)
-			&& !is_color_line(line) && !is_line_empty(line))
+		if (map_start == -1 && !is_config_line(line) && !is_line_empty(line))
 			if (in_map(line))
 				map_start = ft_strlen(joined);
 		tmp = ft_strjoin(joined, line);
@@ -165,7 +170,7 @@ static char	**read_file_lines(const char *path)
 
 /**
  * @brief Coordinates the entire map loading and validation pipeline.
- * This is the main function for the parsing stage, orchestrating five key
+ * This is the main function for the parsing stage, orchestrating ten key
  * steps to process the raw file data into a validated, playable map structure.
  * @param map Pointer to the t_map structure where configuration and grid data
  * will be stored.
@@ -178,8 +183,19 @@ static char	**read_file_lines(const char *path)
  * floor/ceiling colors.
  * 3. **parse_map**: Extract the raw 2D map grid from the file lines.
  * 4. **normalize_map**: Pad the map grid to a rectangular shape. 
- * 5. **validate_map**: Check for map closure (walls), valid characters, and
+ * 5. **collect_sprites**: Move the sprite tiles into the sprite list, then
+ * **parse_heights** reads the optional wall heights.
+ * 6. **build_occupancy**: Pack the walls (and closed doors) into the
+ * solidity bitmaps, then **collect_doors** lists the doors and
+ * **collect_grates** counts the grates.
+ * 7. **validate_map**: Check for map closure (walls), valid characters, and
  * unique player starting position.
+ * 8. **build_distance_field**: Precompute the distance-to-wall field used by
+ * the raycaster to skip empty space.
+ * 9. **bake_lightmaps**: Bake the static lights and ambient occlusion of
+ * every wall face (only if the map declares lights).
+ * 10. **build_pvs**: Precompute the potentially visible sets used to cull
+ * sprites (only if the map has sprites), or read them from their cache.
  */
 bool	load_and_validate_map(t_map *map, const char *path)
 {
@@ -193,8 +209,19 @@ bool	load_and_validate_map(t_map *map, const char *path)
 	if (!parse_map(map, file_lines))
 		return (ft_free_array(file_lines), false);
 	normalize_map(map);
+	if (!collect_sprites(map) || !parse_heights(map, file_lines))
+		return (ft_free_array(file_lines), false);
+	if (!build_occupancy(map) || !collect_doors(map)
+		|| !collect_grates(map))
+		return (ft_free_array(file_lines), false);
 	if (!validate_map(map))
 		return (ft_free_array(file_lines), false);
+	if (!build_distance_field(map))
+		return (ft_free_array(file_lines), false);
+	if (!bake_lightmaps(map))
+		return (ft_free_array(file_lines), false);
+	if (!build_pvs(map, path))
+		return (ft_free_array(file_lines), false);
 	ft_free_array(file_lines);
 	return (true);
 }
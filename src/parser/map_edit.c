@@ -0,0 +1,188 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_edit.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:21:44 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:42:21 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file map_edit.c
+ * @brief Runtime changes of tile solidity (doors opening and closing).
+ * Changing one tile updates everything derived from the layout in place,
+ * without rebuilding it: the occupancy bit of the tile and the bit of its
+ * 8x8 block, the distance field around the tile, the dynamic lights that
+ * reach it, and the map version that invalidates the cached ray hits. The
+ * pre-scaled wall columns need nothing: a moving door only changes which
+ * texture column its rays sample, so they look up other entries. The
+ * potentially visible sets are built with every door open, so they hold
+ * for any door state.
+ * The distance field only changes near the tile. A new wall lowers every
+ * tile of the square rings around it to the ring distance, and the walk
+ * stops at the first ring where nothing was lowered. A removed wall can
+ * only raise the tiles whose distance equalled their ring distance (it may
+ * have been their nearest wall); those look for their new nearest wall,
+ * starting from their old distance.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Finds the i-th tile of the square ring of radius k around a
+ * tile, walking the 8k tiles of the ring clockwise from its top-left
+ * corner.
+ * @param map Pointer to the t_map structure.
+ * @param t Center of the ring in t[0], t[1]; the tile is returned in t[2],
+ * t[3].
+ * @param k Radius of the ring (>= 1).
+ * @param i Index of the tile (0 to 8k - 1).
+ * @return bool True if the tile is inside the grid.
+ */
+static bool	ring_tile(t_map *map, int *t, int k, int i)
+{
+	int	o;
+
+	o = i % (2 * k);
+	t[2] = t[0] - k + o;
+	t[3] = t[1] - k;
+	if (i / (2 * k) == 1)
+	{
+		t[2] = t[0] + k;
+		t[3] = t[1] - k + o;
+	}
+	else if (i / (2 * k) == 2)
+	{
+		t[2] = t[0] + k - o;
+		t[3] = t[1] + k;
+	}
+	else if (i / (2 * k) == 3)
+	{
+		t[2] = t[0] - k;
+		t[3] = t[1] + k - o;
+	}
+	return (t[2] >= 0 && t[3] >= 0 && t[2] < map->width
+		&& t[3] < map->height);
+}
+
+/**
+ * @brief Chebyshev distance from a tile to its nearest solid tile (or the
+ * edge of the grid), searching rings from radius k outwards, saturated at
+ * 255 like the distance field.
+ * @param map Pointer to the t_map structure.
+ * @param x The column index of the tile.
+ * @param y The row index of the tile.
+ * @param k First ring to search; no solid tile may be nearer.
+ * @return int The distance.
+ */
+static int	nearest_wall(t_map *map, int x, int y, int k)
+{
+	int	t[4];
+	int	i;
+
+	t[0] = x;
+	t[1] = y;
+	while (k < 255)
+	{
+		i = 0;
+		while (i < 8 * k)
+		{
+			if (!ring_tile(map, t, k, i++) || is_solid(map, t[2], t[3]))
+				return (k);
+		}
+		k++;
+	}
+	return (255);
+}
+
+/**
+ * @brief Updates the distances of the ring of radius k around a tile that
+ * just became solid (lowered to k) or open (searched again where it may
+ * have been the nearest wall).
+ * @param map Pointer to the t_map structure.
+ * @param t Tile that changed in t[0], t[1]; t[2], t[3] are scratch.
+ * @param k Radius of the ring.
+ * @param solid New solidity of the tile.
+ * @return bool True if a tile of the ring was affected, so the next ring
+ * may be too.
+ */
+static bool	update_ring(t_map *map, int *t, int k, bool solid)
+{
+	unsigned char	*d;
+	bool			hit;
+	int				i;
+
+	hit = false;
+	i = 0;
+	while (i < 8 * k)
+	{
+		if (ring_tile(map, t, k, i++))
+		{
+			d = &map->dist[t[3] * map->width + t[2]];
+			if ((solid && *d > k) || (!solid && *d == k))
+			{
+				hit = true;
+				*d = k;
+				if (!solid)
+					*d = nearest_wall(map, t[2], t[3], k);
+			}
+		}
+	}
+	return (hit);
+}
+
+/**
+ * @brief Recomputes the occupancy bit of the 8x8 block holding a tile.
+ * @param map Pointer to the t_map structure.
+ * @param x The column index of the tile.
+ * @param y The row index of the tile.
+ */
+static void	update_block(t_map *map, int x, int y)
+{
+	uint64_t	*word;
+	uint64_t	bit;
+	int			i;
+
+	word = &map->solid.blocks[(y >> 3) * map->solid.block_stride + (x >> 9)];
+	bit = 1ULL << ((x >> 3) & 63);
+	*word &= ~bit;
+	i = 0;
+	while (i < 64)
+	{
+		if (is_solid(map, (x & ~7) + i % 8, (y & ~7) + i / 8))
+			*word |= bit;
+		i++;
+	}
+}
+
+/**
+ * @brief Makes a tile solid or open and updates the occupancy grid, the
+ * distance field, the dynamic light grid and the map version accordingly.
+ * @param map Pointer to the t_map structure.
+ * @param x The column index of the tile (inside the grid).
+ * @param y The row index of the tile (inside the grid).
+ * @param solid New solidity of the tile.
+ */
+void	set_tile_solid(t_map *map, int x, int y, bool solid)
+{
+	int	t[4];
+	int	k;
+
+	if (is_solid(map, x, y) == solid)
+		return ;
+	relight_tile(map, x, y, -1);
+	map->solid.cells[y * map->solid.stride + (x >> 6)] ^= 1ULL << (x & 63);
+	update_block(map, x, y);
+	map->dist[y * map->width + x] = 0;
+	if (!solid)
+		map->dist[y * map->width + x] = nearest_wall(map, x, y, 1);
+	t[0] = x;
+	t[1] = y;
+	k = 1;
+	while (k < 255 && update_ring(map, t, k, solid))
+		k++;
+	relight_tile(map, x, y, 1);
+	map->version++;
+}
@@ -6,7 +6,7 @@
 /*   By: sergio-jimenez <sergio-jimenez@student.    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/23 17:03:18 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/12/11 13:24:50 by sergio-jime      ###   ########.fr       */
+/*   Updated: 2026/10/19 02:31:25 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,8 +14,9 @@
 
 /**
  * @brief Frees the texture path strings stored in the map structure.
- * Iterates through the 4 cardinal directions (NO, SO, EA, WE) and frees
- * the string memory if it was allocated.
+ * Iterates through the 4 cardinal directions (NO, SO, EA, WE) and the
+ * optional floor/ceiling textures, and frees the string memory if it was
+ * allocated.
  * @param paths The array of strings containing the texture paths.
  * @note This only frees the path strings, not the MLX image pointers
  * (which are handled by the cleanup routine).
@@ -25,7 +26,7 @@ void	free_textures(char **paths)
 	int	i;
 
 	i = 0;
-	while (i < 4)
+	while (i < TEX_COUNT)
 	{
 		if (paths[i])
 			free(paths[i]);
@@ -38,6 +39,7 @@ void	free_textures(char **paths)
  * This includes:
  * - The map grid (2D array of characters).
  * - The texture path strings.
+ * - The distance field and the occupancy bitmaps.
  * @param map Pointer to the t_map structure.
  * @note It does not modify floor/ceiling colors (stack integers) nor
  * MLX images (handled by cleanup_and_exit).
@@ -50,20 +52,23 @@ void	free_map(t_map *map)
 	if (map->grid)
 	{
 		while (i < map->height)
-		{
-			if (map->grid[i])
-				free(map->grid[i]);
-			i++;
-		}
+			free(map->grid[i++]);
 		free(map->grid);
 	}
-	i = 0;
-	while (i < 4)
-	{
-		if (map->tex_paths[i])
-			free(map->tex_paths[i]);
-		i++;
-	}
+	free_textures(map->tex_paths);
+	free(map->dist);
+	free(map->light);
+	free(map->light_of);
+	free(map->dyn.level);
+	free(map->sprites);
+	free(map->pvs.runs);
+	free(map->pvs.first);
+	free(map->pvs.seen);
+	free(map->doors);
+	free(map->door_of);
+	free(map->heights);
+	free(map->solid.cells);
+	free(map->solid.blocks);
 }
 
 /**
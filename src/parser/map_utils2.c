@@ -6,7 +6,7 @@
 /*   By: sergio-jimenez <sergio-jimenez@student.    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/18 16:51:42 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/11/27 18:58:21 by sergio-jime      ###   ########.fr       */
+/*   Updated: 2026/10/19 02:00:24 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -73,9 +73,9 @@ bool	is_line_empty(const char *line)
 
 /**
  * @brief Identifies if a line starts with one of the four required texture
- * identifiers.
- * Checks specifically for "NO ", "SO ", "WE ", or "EA " at the beginning
- * of the line.
+ * identifiers, or the optional sky panorama, sprite, door and grate ones.
+ * Checks specifically for "NO ", "SO ", "WE ", "EA ", "SKY ", "DO ", "GR "
+ * or a sprite key ("S2 ", ...) at the beginning of the line.
  * It only validates the identifier, not the path itself.
  * @param line The string (line) to check.
  * @return bool True if the line matches a texture identifier followed by a
@@ -93,7 +93,10 @@ bool	is_texture_line(const char *line)
 		return (true);
 	if (!ft_strncmp(line, "EA ", 3))
 		return (true);
-	return (false);
+	if (!ft_strncmp(line, "SKY ", 4) || !ft_strncmp(line, "DO ", 3)
+		|| !ft_strncmp(line, "GR ", 3))
+		return (true);
+	return (is_sprite_key(line));
 }
 
 /**
@@ -115,3 +118,16 @@ bool	is_color_line(const char *line)
 		return (true);
 	return (false);
 }
+
+/**
+ * @brief Identifies any configuration line: a texture, a color, a light or
+ * an animation.
+ * Everything before the map block must be one of these or empty.
+ * @param line The string (line) to check.
+ * @return bool True if the line is a configuration entry.
+ */
+bool	is_config_line(const char *line)
+{
+	return (is_texture_line(line) || is_color_line(line)
+		|| is_light_line(line) || is_anim_line(line));
+}
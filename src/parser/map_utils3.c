@@ -6,7 +6,7 @@
 /*   By: sergio-jimenez <sergio-jimenez@student.    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/27 11:19:06 by sergio-jime       #+#    #+#             */
-/*   Updated: 2025/11/29 17:42:31 by sergio-jime      ###   ########.fr       */
+/*   Updated: 2026/10/18 00:45:12 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -49,6 +49,7 @@ bool	check_extension(const char *path)
  * Iterates through the lines array, skipping lines that are:
  * - Valid texture configurations (NO, SO, WE, EA).
  * - Valid color configurations (F, C).
+ * - Optional entries (SKY, lights).
  * - Empty/whitespace-only lines.
  * @param lines The array of strings read from the .cub file.
  * @return int The index of the first line that is neither a configuration
@@ -63,9 +64,7 @@ int	skip_config(char **lines)
 	i = 0;
 	while (lines[i])
 	{
-		if (is_texture_line(lines[i])
-			|| is_color_line(lines[i])
-			|| is_line_empty(lines[i]))
+		if (is_config_line(lines[i]) || is_line_empty(lines[i]))
 			i++;
 		else
 			return (i);
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   occupancy.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:31:07 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 01:37:10 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file occupancy.c
+ * @brief Bit-packed solidity grid shared by the validator, the DDA and the
+ * collision checks.
+ * Every tile is one bit (64 tiles per word) and every 8x8 block of tiles has
+ * an extra bit telling whether it holds any wall, so wall tests are a shift
+ * and a mask and empty blocks can be discarded in a single test.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Marks a tile, and the 8x8 block that contains it, as solid.
+ * @param occ Pointer to the occupancy grid.
+ * @param x The column index of the tile.
+ * @param y The row index of the tile.
+ */
+static void	set_solid(t_occupancy *occ, int x, int y)
+{
+	int	bx;
+	int	by;
+
+	occ->cells[y * occ->stride + (x >> 6)] |= 1ULL << (x & 63);
+	bx = x >> 3;
+	by = y >> 3;
+	occ->blocks[by * occ->block_stride + (bx >> 6)] |= 1ULL << (bx & 63);
+}
+
+/**
+ * @brief Allocates zeroed bitmaps sized for the map dimensions.
+ * @param map Pointer to the normalized t_map structure.
+ * @return bool True on success, false on allocation failure.
+ */
+static bool	alloc_occupancy(t_map *map)
+{
+	t_occupancy	*occ;
+	int			block_rows;
+
+	occ = &map->solid;
+	occ->stride = (map->width + 63) / 64;
+	occ->block_stride = ((map->width + 7) / 8 + 63) / 64;
+	block_rows = (map->height + 7) / 8;
+	occ->cells = ft_calloc(occ->stride * map->height, sizeof(uint64_t));
+	occ->blocks = ft_calloc(occ->block_stride * block_rows, sizeof(uint64_t));
+	if (!occ->cells || !occ->blocks)
+		return (ft_error("Malloc failed\n"), false);
+	return (true);
+}
+
+/**
+ * @brief Builds the occupancy grid from the character grid.
+ * Every '1' tile becomes a set bit, and so does every door ('D'), as doors
+ * start closed, and every grate ('G'). Must run after `normalize_map`, so
+ * the grid is rectangular and padding has already been turned into walls.
+ * @param map Pointer to the normalized t_map structure.
+ * @return bool True on success, false on allocation failure.
+ * @note The bitmaps are freed by `free_map`.
+ */
+bool	build_occupancy(t_map *map)
+{
+	int	x;
+	int	y;
+
+	if (!alloc_occupancy(map))
+		return (false);
+	y = 0;
+	while (y < map->height)
+	{
+		x = 0;
+		while (x < map->width)
+		{
+			if (ft_strchr("1DG", map->grid[y][x]))
+				set_solid(&map->solid, x, y);
+			x++;
+		}
+		y++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Tells whether a tile blocks rays and movement.
+ * @param map Pointer to the t_map structure.
+ * @param x The column index of the tile.
+ * @param y The row index of the tile.
+ * @return bool True for walls and for any tile outside the grid.
+ */
+bool	is_solid(t_map *map, int x, int y)
+{
+	t_occupancy	*occ;
+
+	if (x < 0 || y < 0 || x >= map->width || y >= map->height)
+		return (true);
+	occ = &map->solid;
+	return ((occ->cells[y * occ->stride + (x >> 6)] >> (x & 63)) & 1);
+}
+
+/**
+ * @brief Tells whether an 8x8 block of tiles is completely free of walls.
+ * @param map Pointer to the t_map structure.
+ * @param bx The block column (tile x / 8).
+ * @param by The block row (tile y / 8).
+ * @return bool True if no tile of the block is solid. Blocks outside the
+ * grid are never empty.
+ */
+bool	is_block_empty(t_map *map, int bx, int by)
+{
+	t_occupancy	*occ;
+
+	if (bx < 0 || by < 0 || bx > (map->width - 1) >> 3
+		|| by > (map->height - 1) >> 3)
+		return (false);
+	occ = &map->solid;
+	return (!((occ->blocks[by * occ->block_stride + (bx >> 6)]
+				>> (bx & 63)) & 1));
+}
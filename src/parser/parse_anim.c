@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_anim.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:55:56 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:00:23 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file parse_anim.c
+ * @brief Parsing of the optional animated wall textures of the .cub file.
+ * An animation line is "AN key frames fps": the texture of wall `key` (NO,
+ * SO, WE or EA) is a vertical strip of `frames` frames of equal height,
+ * played at `fps` frames per second. The strip is loaded like any other
+ * texture; the frames are picked from it at draw time (see anim.c).
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Identifies if a line starts with the animation ("AN") identifier.
+ * @param line The string (line) to check.
+ * @return bool True if the line starts with "AN ", false otherwise.
+ */
+bool	is_anim_line(const char *line)
+{
+	if (!line)
+		return (false);
+	return (!ft_strncmp(line, "AN ", 3));
+}
+
+/**
+ * @brief Reads a positive count made of digits only.
+ * @param s The string to read.
+ * @param max Largest accepted value.
+ * @return int The count, or -1 if it is not a number in [1, max].
+ */
+static int	parse_count(const char *s, int max)
+{
+	int	i;
+	int	n;
+
+	i = 0;
+	while (s[i] && ft_isdigit(s[i]) && i < 4)
+		i++;
+	if (i == 0 || s[i])
+		return (-1);
+	n = ft_atoi(s);
+	if (n < 1 || n > max)
+		return (-1);
+	return (n);
+}
+
+/**
+ * @brief Index of a wall texture identifier.
+ * @param key The identifier (NO, SO, WE or EA).
+ * @return int Its index in `map->tex_paths` (0-3), -1 for anything else.
+ */
+static int	wall_index(const char *key)
+{
+	if (!ft_strncmp(key, "NO", 3))
+		return (0);
+	if (!ft_strncmp(key, "SO", 3))
+		return (1);
+	if (!ft_strncmp(key, "WE", 3))
+		return (2);
+	if (!ft_strncmp(key, "EA", 3))
+		return (3);
+	return (-1);
+}
+
+/**
+ * @brief Parses an animation line into `map->anims`.
+ * @param map Pointer to the t_map structure.
+ * @param line The configuration line.
+ * @return bool True on success, false on error.
+ */
+bool	parse_anim(t_map *map, const char *line)
+{
+	char	**split;
+	t_anim	*a;
+	int		i;
+
+	split = ft_split(line, ' ');
+	if (!split || !split[0] || !split[1] || !split[2] || !split[3]
+		|| split[4] || wall_index(split[1]) < 0)
+		return (ft_free_array(split), ft_error("Invalid animation\n"), false);
+	i = wall_index(split[1]);
+	a = &map->anims[i];
+	if (a->count)
+		return (ft_free_array(split), ft_error("Duplicate animation\n"),
+			false);
+	a->count = parse_count(split[2], ANIM_MAX_FRAMES);
+	a->fps = parse_count(split[3], ANIM_MAX_FPS);
+	ft_free_array(split);
+	if (a->count < 0 || a->fps < 0)
+		return (ft_error("Invalid animation\n"), false);
+	return (true);
+}
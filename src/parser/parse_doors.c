@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_doors.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:21:08 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 01:37:10 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file parse_doors.c
+ * @brief Door tiles ('D') and the optional texture keys.
+ * Doors are part of the grid like walls, and start closed (solid). Once
+ * the occupancy grid is built, each one is given an entry in `map->doors`
+ * with its panel oriented across the passage it closes.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Tells whether a configuration line declares one of the optional
+ * textures (SKY, sprite textures, DO and GR), which do not count towards
+ * the six required elements.
+ * @param line The string (line) to check.
+ * @return bool True for an optional texture key.
+ */
+bool	is_optional_texture(const char *line)
+{
+	return (!ft_strncmp(line, "SKY ", 4) || !ft_strncmp(line, "DO ", 3)
+		|| !ft_strncmp(line, "GR ", 3) || is_sprite_key(line));
+}
+
+/**
+ * @brief Texture index of an optional texture key: TEX_SKY, TEX_DOOR,
+ * TEX_GRATE or TEX_SPRITE + type.
+ * @param line A configuration line accepted by `is_optional_texture`.
+ * @return int Index in `map->tex_paths`.
+ */
+int	optional_texture_index(const char *line)
+{
+	if (!ft_strncmp(line, "SKY ", 4))
+		return (TEX_SKY);
+	if (!ft_strncmp(line, "DO ", 3))
+		return (TEX_DOOR);
+	if (!ft_strncmp(line, "GR ", 3))
+		return (TEX_GRATE);
+	return (TEX_SPRITE + line[1] - '2');
+}
+
+/**
+ * @brief Tells whether a tile holds a door, whatever its state.
+ * @param map Pointer to the t_map structure.
+ * @param x The column index of the tile.
+ * @param y The row index of the tile.
+ * @return bool True for door tiles, false for any other tile or outside
+ * the grid.
+ */
+bool	is_door(t_map *map, int x, int y)
+{
+	if (!map->door_of || x < 0 || y < 0 || x >= map->width
+		|| y >= map->height)
+		return (false);
+	return (map->door_of[y * map->width + x] >= 0);
+}
+
+/**
+ * @brief Counts the door tiles of the grid and checks that the door
+ * texture is given if there are any.
+ * @param map Pointer to the normalized t_map structure.
+ * @return int Number of doors, or -1 if the texture is missing.
+ */
+static int	count_doors(t_map *map)
+{
+	int	count;
+	int	i;
+
+	count = 0;
+	i = 0;
+	while (i < map->width * map->height)
+	{
+		count += map->grid[i / map->width][i % map->width] == 'D';
+		i++;
+	}
+	if (count > 0 && !map->tex_paths[TEX_DOOR])
+		return (ft_error("Missing door texture\n"), -1);
+	return (count);
+}
+
+/**
+ * @brief Collects the door tiles into `map->doors`, closed, and fills the
+ * tile-to-door table. A door with walls on its west and east sides closes
+ * a passage along Y, so its panel lies in the plane y = y + 0.5; any other
+ * door gets the plane x = x + 0.5. Must run after `build_occupancy`.
+ * @param map Pointer to the normalized t_map structure.
+ * @return bool True on success, false on missing texture or malloc failure.
+ * @note `map->doors` and `map->door_of` are freed by `free_map`.
+ */
+bool	collect_doors(t_map *map)
+{
+	t_door	*d;
+	int		i;
+
+	map->door_count = count_doors(map);
+	if (map->door_count <= 0)
+		return (map->door_count == 0);
+	map->doors = ft_calloc(map->door_count, sizeof(t_door));
+	map->door_of = malloc(map->width * map->height * sizeof(int));
+	if (!map->doors || !map->door_of)
+		return (ft_error("Malloc failed\n"), false);
+	d = map->doors;
+	i = -1;
+	while (++i < map->width * map->height)
+	{
+		map->door_of[i] = -1;
+		if (map->grid[i / map->width][i % map->width] == 'D')
+		{
+			d->x = i % map->width;
+			d->y = i / map->width;
+			d->side = is_solid(map, d->x - 1, d->y)
+				&& is_solid(map, d->x + 1, d->y);
+			map->door_of[i] = d++ - map->doors;
+		}
+	}
+	return (true);
+}
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_grates.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:32:10 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 01:37:11 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file parse_grates.c
+ * @brief Grate and window tiles ('G'): walls whose texture may have
+ * transparent texels, through which the walls behind them are seen.
+ * They block movement like any wall and are solid in the occupancy grid;
+ * the raycaster walks on through them (see grates.c).
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Tells whether a tile is a grate.
+ * @param map Pointer to the t_map structure.
+ * @param x The column index of the tile.
+ * @param y The row index of the tile.
+ * @return bool True for grate tiles, false for any other tile or outside
+ * the grid.
+ */
+bool	is_grate(t_map *map, int x, int y)
+{
+	if (!map->grates || x < 0 || y < 0 || x >= map->width
+		|| y >= map->height)
+		return (false);
+	return (map->grid[y][x] == 'G');
+}
+
+/**
+ * @brief Counts the grate tiles into `map->grates` and checks that the
+ * grate texture (GR) is given if there are any.
+ * @param map Pointer to the normalized t_map structure.
+ * @return bool True on success, false if the texture is missing.
+ */
+bool	collect_grates(t_map *map)
+{
+	int	i;
+
+	map->grates = 0;
+	i = 0;
+	while (i < map->width * map->height)
+	{
+		map->grates += map->grid[i / map->width][i % map->width] == 'G';
+		i++;
+	}
+	if (map->grates > 0 && !map->tex_paths[TEX_GRATE])
+		return (ft_error("Missing grate texture\n"), false);
+	return (true);
+}
@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_heights.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:40:43 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:20:43 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file parse_heights.c
+ * @brief Wall heights, declared in an optional section after the map.
+ * The section starts with a line holding only HEIGHTS and then has up to
+ * one row per map row, laid out like the map. In it, a digit gives the
+ * wall of that tile a height in half tiles ('1' for a half wall, '2' for
+ * the standard height, '4' for a pillar twice as tall); spaces and dots
+ * keep the standard height. Only walls ('1') can be given a height.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Tells whether a line starts the HEIGHTS section.
+ * @param line The string (line) to check, which may still end with its
+ * newline.
+ * @return bool True for the section header.
+ */
+bool	is_heights_line(const char *line)
+{
+	return (!ft_strncmp(line, "HEIGHTS", 7)
+		&& (line[7] == '\0' || line[7] == '\n'));
+}
+
+/**
+ * @brief Reads one row of the HEIGHTS section into `map->heights`.
+ * @param map Pointer to the normalized t_map structure.
+ * @param row The row to read.
+ * @param y The map row it describes.
+ * @return bool True on success, false (with an error) on a character that
+ * is not a height or a height on a tile that is not a wall.
+ */
+static bool	parse_height_row(t_map *map, const char *row, int y)
+{
+	int	x;
+
+	x = 0;
+	while (row[x] && x < map->width)
+	{
+		if (row[x] >= '1' && row[x] <= '9' && map->grid[y][x] != '1')
+			return (ft_error("Height on a tile that is not a wall\n"), false);
+		if (row[x] >= '1' && row[x] <= '9')
+			map->heights[y * map->width + x] = row[x] - '0';
+		else if (row[x] != ' ' && row[x] != '.')
+			return (ft_error("Invalid wall height\n"), false);
+		if (map->heights[y * map->width + x] > map->max_height)
+			map->max_height = map->heights[y * map->width + x];
+		x++;
+	}
+	if (row[x])
+		return (ft_error("Height row longer than the map\n"), false);
+	return (true);
+}
+
+/**
+ * @brief Reads the HEIGHTS section, if the file has one, into
+ * `map->heights`. Must run after `normalize_map`. Only the section header
+ * may follow the map rows; empty rows were already rejected while reading
+ * the file (see check_map_block), so the rows match the map rows in order.
+ * @param map Pointer to the normalized t_map structure.
+ * @param lines The array of all strings read from the .cub file.
+ * @return bool True on success or without a section, false on error.
+ * @note `map->heights` is freed by `free_map`.
+ */
+bool	parse_heights(t_map *map, char **lines)
+{
+	int	i;
+	int	y;
+
+	i = skip_config(lines) + map->height;
+	if (!lines[i])
+		return (true);
+	if (!is_heights_line(lines[i]))
+		return (ft_error("Unexpected line after the map\n"), false);
+	map->heights = malloc(map->width * map->height);
+	if (!map->heights)
+		return (ft_error("Malloc failed\n"), false);
+	ft_memset(map->heights, 2, map->width * map->height);
+	map->max_height = 2;
+	y = 0;
+	while (lines[++i])
+	{
+		if (y == map->height)
+			return (ft_error("More height rows than map rows\n"), false);
+		if (!parse_height_row(map, lines[i], y++))
+			return (false);
+	}
+	return (true);
+}
+
+/**
+ * @brief Height of the wall of a tile, in tiles.
+ * @param map Pointer to the t_map structure.
+ * @param x The column index of the tile.
+ * @param y The row index of the tile.
+ * @return double Its height, 1 for standard walls, other tiles and tiles
+ * outside the grid.
+ */
+double	wall_height(t_map *map, int x, int y)
+{
+	if (!map->heights || x < 0 || y < 0 || x >= map->width
+		|| y >= map->height)
+		return (1);
+	return (map->heights[y * map->width + x] * 0.5);
+}
+
+/**
+ * @brief Tells whether a solid tile leaves what is behind it in sight:
+ * doors (whatever their state), grates and walls lower than the standard
+ * height.
+ * @param map Pointer to the t_map structure.
+ * @param x The column index of the tile.
+ * @param y The row index of the tile.
+ * @return bool True if the view goes on past the tile.
+ */
+bool	is_see_through(t_map *map, int x, int y)
+{
+	return (is_door(map, x, y) || is_grate(map, x, y)
+		|| wall_height(map, x, y) < 1);
+}
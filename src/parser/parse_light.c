@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_light.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:02:33 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:31:25 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file parse_light.c
+ * @brief Parsing of the optional static lights of the .cub file.
+ * A light line is "L x,y,radius": the tile holding the light and the
+ * distance in tiles at which it fades out, as plain non-negative integers
+ * (up to LIGHT_MAX_VALUE), so lights can be placed anywhere on large maps.
+ * Lights are optional and may appear anywhere in the configuration block.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Identifies if a line starts with the light ('L') identifier.
+ * @param line The string (line) to check.
+ * @return bool True if the line starts with "L ", false otherwise.
+ */
+bool	is_light_line(const char *line)
+{
+	if (!line)
+		return (false);
+	return (!ft_strncmp(line, "L ", 2));
+}
+
+/**
+ * @brief Reads a non-negative integer made of digits only.
+ * @param s The string to read.
+ * @return int The value, or -1 if it is not a number in
+ * [0, LIGHT_MAX_VALUE].
+ */
+static int	parse_value(const char *s)
+{
+	int	i;
+	int	n;
+
+	i = 0;
+	n = 0;
+	while (ft_isdigit(s[i]) && n <= LIGHT_MAX_VALUE)
+		n = n * 10 + s[i++] - '0';
+	if (i == 0 || s[i] || n > LIGHT_MAX_VALUE)
+		return (-1);
+	return (n);
+}
+
+/**
+ * @brief Splits "x,y,radius" into exactly three values.
+ * Empty fields (",," or a trailing comma) are rejected by counting the
+ * commas, since ft_split skips empty tokens.
+ * @param s The value part of the light line.
+ * @param out The three parsed values.
+ * @return bool True if the three values are valid numbers.
+ */
+static bool	read_values(const char *s, int out[3])
+{
+	char	**v;
+	int		commas;
+	int		i;
+
+	commas = 0;
+	i = 0;
+	while (s[i])
+		commas += (s[i++] == ',');
+	v = ft_split(s, ',');
+	if (!v)
+		return (false);
+	i = 0;
+	while (i < 3 && v[i])
+	{
+		out[i] = parse_value(v[i]);
+		if (out[i] < 0)
+			break ;
+		i++;
+	}
+	ft_free_array(v);
+	return (i == 3 && commas == 2);
+}
+
+/**
+ * @brief Parses a light line and appends the light to `map->lights`.
+ * The light sits at the center of its tile; its tile is checked against
+ * the map once the grid is known (see check_lights).
+ * @param map Pointer to the t_map structure.
+ * @param line The configuration line.
+ * @return bool True on success, false on error.
+ */
+bool	parse_light(t_map *map, const char *line)
+{
+	char	**split;
+	int		v[3];
+	bool	ok;
+
+	split = parse_color_aux(line);
+	if (split == NULL)
+		return (false);
+	ok = read_values(split[1], v);
+	ft_free_array(split);
+	if (!ok || v[2] == 0)
+		return (ft_error("Invalid light\n"), false);
+	if (map->light_count == MAX_LIGHTS)
+		return (ft_error("Too many lights\n"), false);
+	map->lights[map->light_count].x = v[0] + 0.5;
+	map->lights[map->light_count].y = v[1] + 0.5;
+	map->lights[map->light_count].radius = v[2];
+	map->light_count++;
+	return (true);
+}
+
+/**
+ * @brief Checks that every light sits on an open tile of the map.
+ * @param map Pointer to the t_map structure.
+ * @return bool True if all lights are valid.
+ */
+bool	check_lights(t_map *map)
+{
+	int	i;
+
+	i = 0;
+	while (i < map->light_count)
+	{
+		if (is_solid(map, (int)map->lights[i].x, (int)map->lights[i].y))
+			return (ft_error("Light outside the map or in a wall\n"), false);
+		i++;
+	}
+	return (true);
+}
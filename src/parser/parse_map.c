@@ -6,7 +6,7 @@
 /*   By: sergio-jimenez <sergio-jimenez@student.    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/21 09:58:26 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/11/29 19:22:08 by sergio-jime      ###   ########.fr       */
+/*   Updated: 2026/10/19 01:48:53 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -22,8 +22,8 @@
 /**
  * @brief Calculates the number of lines corresponding to the map block.
  * Counts the number of strings in the array `lines` starting from the `start`
- * index up to the NULL terminator, effectively determining the height of the
- * raw map.
+ * index up to the NULL terminator or the HEIGHTS section, effectively
+ * determining the height of the raw map.
  * @param lines The array of all strings read from the .cub file.
  * @param start The index where the map block begins (returned by `skip_config`).
  * @return int The total number of map lines (the map height).
@@ -33,7 +33,7 @@ static int	count_map_lines(char **lines, int start)
 	int	i;
 
 	i = start;
-	while (lines[i])
+	while (lines[i] && !is_heights_line(lines[i]))
 		i++;
 	return (i - start);
 }
@@ -6,7 +6,7 @@
 /*   By: sergio-jimenez <sergio-jimenez@student.    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/18 16:55:46 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/12/16 18:26:01 by sergio-jime      ###   ########.fr       */
+/*   Updated: 2026/10/19 02:00:24 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -56,8 +56,9 @@ static bool	parse_color(t_map *map, const char *line)
 }
 
 /**
- * @brief Parses a texture configuration line (NO, SO, WE, EA) and stores
- * the file path.
+ * @brief Parses a texture configuration line (NO, SO, WE, EA, or the
+ * optional sky panorama SKY, sprite textures S2, S3, ... and door texture
+ * DO) and stores the file path.
  * Saves a dynamically allocated copy of the path string into the correct index
  * of `map->tex_paths`.
  * @param map Pointer to the t_map structure.
@@ -66,7 +67,9 @@ static bool	parse_color(t_map *map, const char *line)
  * @details
  * 1. Splits the line by space (' ') to separate the identifier (NO/SO/WE/EA)
  * from the path.
- * 2. Maps the identifier to the corresponding integer index (0-3).
+ * 2. Maps the identifier to the corresponding integer index (0-3, or see
+ * `optional_texture_index`). Only called on lines accepted by
+ * `is_texture_line`, so the identifier is always one of those.
  * 3. Checks for duplicate configuration (`map->tex_paths[index] != NULL`).
  * 4. **Memory Management**: Uses `ft_strdup` to allocate and store a persistent
  * copy of the file path. This allocated memory must be freed later
@@ -81,7 +84,6 @@ static bool	parse_texture(t_map *map, const char *line)
 	split = parse_texture_aux(line);
 	if (split == NULL)
 		return (false);
-	index = -1;
 	if (!ft_strncmp(split[0], "NO", 3))
 		index = 0;
 	else if (!ft_strncmp(split[0], "SO", 3))
@@ -90,14 +92,50 @@ static bool	parse_texture(t_map *map, const char *line)
 		index = 2;
 	else if (!ft_strncmp(split[0], "EA", 3))
 		index = 3;
-	if (index == -1)
-		return (ft_free_array(split), ft_error("Unknown texture\n"), false);
+	else
+		index = optional_texture_index(line);
 	if (map->tex_paths[index] != NULL)
 		return (ft_free_array(split), ft_error("Duplicate texture\n"), false);
 	map->tex_paths[index] = ft_strdup(split[1]);
+	ft_free_array(split);
 	if (!map->tex_paths[index])
-		return (ft_free_array(split), ft_error("Malloc error\n"), false);
+		return (ft_error("Malloc error\n"), false);
+	return (true);
+}
+
+/**
+ * @brief Parses a floor ('F') or ceiling ('C') line, which holds either an
+ * RGB color or the path to an .xpm texture for a textured floor/ceiling.
+ * @param map Pointer to the t_map structure.
+ * @param line The configuration line.
+ * @return bool True on success, false on error.
+ */
+static bool	parse_surface(t_map *map, const char *line)
+{
+	char	**split;
+	int		index;
+	int		color;
+
+	index = TEX_CEILING;
+	color = map->ceiling_color;
+	if (line[0] == 'F')
+	{
+		index = TEX_FLOOR;
+		color = map->floor_color;
+	}
+	if (map->tex_paths[index] != NULL)
+		return (ft_error("Duplicate texture\n"), false);
+	if (!ft_strrchr(line, '.') || ft_strncmp(ft_strrchr(line, '.'), ".xpm", 5))
+		return (parse_color(map, line));
+	if (color != 0)
+		return (ft_error("Duplicate texture\n"), false);
+	split = parse_texture_aux(line);
+	if (split == NULL)
+		return (false);
+	map->tex_paths[index] = ft_strdup(split[1]);
 	ft_free_array(split);
+	if (!map->tex_paths[index])
+		return (ft_error("Malloc error\n"), false);
 	return (true);
 }
 
@@ -105,12 +143,15 @@ static bool	parse_texture(t_map *map, const char *line)
  * @brief Auxiliary function that iterates through the raw file lines and
  * attempts to parse configuration entries.
  * It checks for texture, color, and empty lines, delegating the parsing work
- * and counting successful entries.
+ * and counting successful entries. Optional entries (SKY, sprite textures,
+ * lights, animations) are not
+ * counted, so the loop keeps going past the 6 required ones while lines
+ * still belong to the configuration block.
  * @param map Pointer to the t_map structure.
  * @param lines Array of strings containing all lines from the .cub file.
  * @param parsed The initial count of items already parsed.
  * @return int The total number of valid configuration items found
- * (4 textures + 2 colors = 6), or 0 on error.
+ * (4 textures + floor + ceiling = 6), or 0 on error.
  */
 static int	parse_config_aux(t_map *map, char **lines, int parsed)
 {
@@ -119,22 +160,21 @@ static int	parse_config_aux(t_map *map, char **lines, int parsed)
 	i = 0;
 	if (!*lines)
 		return (ft_error("Empty file\n"), false);
-	while (lines[i] && parsed < 6)
+	while (lines[i] && (parsed < 6 || is_config_line(lines[i])
+			|| is_line_empty(lines[i])))
 	{
-		if (is_texture_line(lines[i]))
-		{
-			if (!parse_texture(map, lines[i]))
-				return (false);
-			parsed++;
-		}
-		else if (is_color_line(lines[i]))
-		{
-			if (!parse_color(map, lines[i]))
-				return (false);
-			parsed++;
-		}
-		else if (!is_line_empty(lines[i]))
+		if (is_texture_line(lines[i]) && !parse_texture(map, lines[i]))
+			return (false);
+		else if (is_color_line(lines[i]) && !parse_surface(map, lines[i]))
+			return (false);
+		else if (is_light_line(lines[i]) && !parse_light(map, lines[i]))
+			return (false);
+		else if (is_anim_line(lines[i]) && !parse_anim(map, lines[i]))
+			return (false);
+		else if (!is_config_line(lines[i]) && !is_line_empty(lines[i]))
 			return (ft_error("Invalid config line\n"), false);
+		parsed += is_color_line(lines[i]) || (is_texture_line(lines[i])
+				&& !is_optional_texture(lines[i]));
 		i++;
 	}
 	return (parsed);
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_sprites.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:05:31 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/18 18:05:31 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file parse_sprites.c
+ * @brief Sprite map characters and sprite texture keys.
+ * Each object type has a map character ('2', '3', ...) and a texture key
+ * ("S2", "S3", ...). After normalization, sprite tiles are collected into
+ * `map->sprites` and turned into plain floor.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Tells whether a map character places a sprite.
+ * @param c The character to check.
+ * @return bool True for '2' up to '2' + SPRITE_TYPES - 1.
+ */
+bool	is_sprite_char(char c)
+{
+	return (c >= '2' && c < '2' + SPRITE_TYPES);
+}
+
+/**
+ * @brief Tells whether a configuration line declares a sprite texture
+ * ("S2 ", "S3 ", ...).
+ * @param line The string (line) to check.
+ * @return bool True if the line starts with a sprite texture key.
+ */
+bool	is_sprite_key(const char *line)
+{
+	return (line && line[0] == 'S' && is_sprite_char(line[1])
+		&& line[2] == ' ');
+}
+
+/**
+ * @brief Counts the sprite tiles of the grid and checks that every type
+ * in use has a texture.
+ * @param map Pointer to the normalized t_map structure.
+ * @return int Number of sprites, or -1 if a texture is missing.
+ */
+static int	count_sprites(t_map *map)
+{
+	int	count;
+	int	x;
+	int	y;
+
+	count = 0;
+	y = 0;
+	while (y < map->height)
+	{
+		x = 0;
+		while (x < map->width)
+		{
+			if (is_sprite_char(map->grid[y][x])
+				&& !map->tex_paths[TEX_SPRITE + map->grid[y][x] - '2'])
+				return (ft_error("Missing sprite texture\n"), -1);
+			count += is_sprite_char(map->grid[y][x]);
+			x++;
+		}
+		y++;
+	}
+	return (count);
+}
+
+/**
+ * @brief Moves every sprite tile of the grid into `map->sprites`, centered
+ * on its tile, and leaves floor ('0') in its place. Must run after
+ * `normalize_map` and before `build_occupancy`, so sprite tiles are then
+ * validated and rendered as floor.
+ * @param map Pointer to the normalized t_map structure.
+ * @return bool True on success, false on missing texture or malloc failure.
+ * @note `map->sprites` is freed by `free_map`.
+ */
+bool	collect_sprites(t_map *map)
+{
+	t_sprite	*s;
+	int			i;
+
+	map->sprite_count = count_sprites(map);
+	if (map->sprite_count <= 0)
+		return (map->sprite_count == 0);
+	map->sprites = malloc(map->sprite_count * sizeof(t_sprite));
+	if (!map->sprites)
+		return (ft_error("Malloc failed\n"), false);
+	s = map->sprites;
+	i = 0;
+	while (i < map->width * map->height)
+	{
+		if (is_sprite_char(map->grid[i / map->width][i % map->width]))
+		{
+			s->x = i % map->width + 0.5;
+			s->y = i / map->width + 0.5;
+			s->type = map->grid[i / map->width][i % map->width] - '2';
+			map->grid[i / map->width][i % map->width] = '0';
+			s++;
+		}
+		i++;
+	}
+	return (true);
+}
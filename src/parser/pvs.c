@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pvs.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:10:49 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:41:59 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file pvs.c
+ * @brief Potentially visible sets, computed once after loading the map.
+ * The set of an open tile holds every tile visible from some point inside
+ * it, found with an exact field of view (see pvs_fov.c), so it is
+ * conservative: a tile left out cannot be seen from anywhere in the tile.
+ * It is then grown by one tile in every direction, since a sprite standing
+ * off the center of its tile reaches into the next one. The sets let the
+ * renderer drop sprites the player cannot see before doing any projection
+ * work.
+ * Building the sets of a big open map takes seconds; builds made with
+ * PVS_CACHE=1 write them to a cache file next to the map and read them back
+ * on the next load. They are skipped on maps without sprites (nothing to
+ * cull) and on maps of more than PVS_MAX_TILES tiles.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Allocates the scratch buffers of the field of view: one view
+ * more than the tiles of the map (every wall tile splits a view at most
+ * once per quadrant) and two corners per tile.
+ * @param map Pointer to the t_map structure.
+ * @param f The field of view state to set up.
+ * @return bool True on success, false on allocation failure.
+ */
+static bool	init_fov(t_map *map, t_fov *f)
+{
+	int	n;
+
+	n = map->width * map->height;
+	f->map = map;
+	f->seen = map->pvs.seen;
+	f->views = malloc((n + 1) * sizeof(t_fov_view));
+	f->bumps = malloc(2 * n * sizeof(t_fov_bump));
+	map->pvs.size = n;
+	map->pvs.runs = malloc(n * sizeof(unsigned short));
+	return (f->views && f->bumps && map->pvs.runs);
+}
+
+/**
+ * @brief Computes and encodes the set of one tile. Walls get an empty one,
+ * which decodes as the full set.
+ * @param f The field of view state.
+ * @param tmp Scratch set of the same size as `map->pvs.seen`.
+ * @param i Index of the tile.
+ * @return bool True on success, false on allocation failure.
+ */
+static bool	tile_set(t_fov *f, uint64_t *tmp, int i)
+{
+	t_map	*map;
+	int		n;
+
+	map = f->map;
+	n = map->width * map->height;
+	map->pvs.first[i] = map->pvs.count;
+	if (is_solid(map, i % map->width, i / map->width)
+		&& !is_door(map, i % map->width, i / map->width))
+		return (true);
+	tile_fov(f, i % map->width, i / map->width);
+	dilate_set(map->pvs.seen, tmp, (n + 63) >> 6, map->width);
+	return (encode_set(&map->pvs, map->pvs.seen, n));
+}
+
+/**
+ * @brief Computes and encodes the set of every tile.
+ * @param map Pointer to the t_map structure, with `first` and `seen`
+ * allocated.
+ * @return bool True on success, false on allocation failure.
+ */
+static bool	fill_sets(t_map *map)
+{
+	t_fov		f;
+	uint64_t	*tmp;
+	bool		ok;
+	int			n;
+	int			i;
+
+	n = map->width * map->height;
+	tmp = malloc(((n + 63) >> 6) * sizeof(uint64_t));
+	ok = init_fov(map, &f) && tmp;
+	i = 0;
+	while (ok && i < n)
+		ok = tile_set(&f, tmp, i++);
+	map->pvs.first[n] = map->pvs.count;
+	free(f.views);
+	free(f.bumps);
+	free(tmp);
+	return (ok);
+}
+
+/**
+ * @brief Builds the potentially visible sets of the map. With PVS_CACHE,
+ * they are read from the cache file next to it (see pvs_cache.c) when it
+ * matches the map, and freshly built sets are written to that file. Must
+ * run after the occupancy grid is built. RENDER_STATS builds print the
+ * time it took and the memory the sets use.
+ * @param map Pointer to the t_map structure.
+ * @param path Path of the .cub file.
+ * @return bool True on success (or when the map does not need them),
+ * false on allocation failure.
+ */
+bool	build_pvs(t_map *map, const char *path)
+{
+	clock_t	start;
+	bool	cached;
+	int		n;
+
+	n = map->width * map->height;
+	if (map->sprite_count == 0 || n > PVS_MAX_TILES)
+		return (true);
+	start = clock();
+	map->pvs.cell = -1;
+	map->pvs.first = malloc((n + 1) * sizeof(int));
+	map->pvs.seen = malloc(((n + 63) >> 6) * sizeof(uint64_t));
+	if (!map->pvs.first || !map->pvs.seen)
+		return (ft_error("Malloc failed\n"), false);
+	cached = PVS_CACHE && load_pvs_cache(map, path);
+	if (!cached && !fill_sets(map))
+		return (ft_error("Malloc failed\n"), false);
+	if (!cached && PVS_CACHE)
+		save_pvs_cache(map, path);
+	if (RENDER_STATS)
+		printf("pvs: %d tiles in %.1f ms (cached: %d), %ld KB\n", n,
+			1000.0 * (clock() - start) / CLOCKS_PER_SEC, cached,
+			(map->pvs.count * sizeof(unsigned short)
+				+ (n + 1) * sizeof(int)) / 1024);
+	return (true);
+}
+
+/**
+ * @brief Tells whether tile `to` may be visible from tile `from`. The set
+ * of `from` is decoded the first time it is asked for and kept until
+ * another tile is asked for, so the lookups of a frame are one bit test.
+ * Without sets, everything may be visible.
+ * @param map Pointer to the t_map structure.
+ * @param from Index (y * width + x) of the tile the viewer stands in.
+ * @param to Index of the tile looked at.
+ * @return bool False only if `to` is certainly hidden from `from`.
+ */
+bool	pvs_visible(t_map *map, int from, int to)
+{
+	if (!map->pvs.runs)
+		return (true);
+	if (from != map->pvs.cell)
+		decode_set(&map->pvs, from, map->width * map->height);
+	return ((map->pvs.seen[to >> 6] >> (to & 63)) & 1);
+}
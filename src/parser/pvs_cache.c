@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pvs_cache.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:14:31 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:42:00 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file pvs_cache.c
+ * @brief Cache file of the potentially visible sets, stored next to the
+ * map as "<map>.cub.pvs" so they are only built on the first load. Only
+ * builds made with PVS_CACHE=1 use it; others never touch the disk.
+ * The file holds a key (magic number, changed whenever the way the sets
+ * are built changes, map size and a hash of the solid tiles), the number
+ * of run lengths, the `first` table and the run lengths. It is used only
+ * if its key matches the map and the tables are consistent; otherwise the
+ * sets are built again and the file rewritten.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Opens the cache file of a map.
+ * @param path Path of the .cub file.
+ * @param flags Flags passed to open().
+ * @return int File descriptor, or -1 on failure.
+ */
+static int	open_cache(const char *path, int flags)
+{
+	char	*name;
+	int		fd;
+
+	name = ft_strjoin(path, ".pvs");
+	if (!name)
+		return (-1);
+	fd = open(name, flags, 0644);
+	free(name);
+	return (fd);
+}
+
+/**
+ * @brief Computes the key a cache file must start with to belong to the
+ * map: magic number, size, ray count and a FNV-1a hash of the solid tiles
+ * and of those that can be seen through.
+ * @param map Pointer to the t_map structure.
+ * @param key Array of 4 words to fill.
+ */
+static void	cache_key(t_map *map, unsigned int *key)
+{
+	unsigned int	hash;
+	int				i;
+
+	hash = 2166136261u;
+	i = 0;
+	while (i < map->width * map->height)
+	{
+		hash = (hash ^ (is_solid(map, i % map->width, i / map->width)
+					+ 2 * is_door(map, i % map->width, i / map->width)
+					+ 4 * is_see_through(map, i % map->width, i / map->width)))
+			* 16777619u;
+		i++;
+	}
+	key[0] = PVS_CACHE_MAGIC;
+	key[1] = map->width;
+	key[2] = map->height;
+	key[3] = hash;
+}
+
+/**
+ * @brief Reads the tables of a cache file whose key matched and checks
+ * that they are usable: `first` starts at 0, never decreases and ends at
+ * the number of run lengths.
+ * @param fd Cache file, positioned after the header.
+ * @param p Pointer to the sets, with `first` allocated.
+ * @param n Number of tiles of the map.
+ * @param count Number of run lengths announced by the header.
+ * @return bool True if both tables were read and are consistent.
+ */
+static bool	read_sets(int fd, t_pvs *p, int n, unsigned int count)
+{
+	ssize_t	size;
+	int		i;
+
+	p->count = count;
+	p->size = count;
+	p->runs = malloc(count * sizeof(unsigned short));
+	if (!p->runs)
+		return (false);
+	size = (n + 1) * sizeof(int);
+	if (read(fd, p->first, size) != size)
+		return (false);
+	size = count * sizeof(unsigned short);
+	if (read(fd, p->runs, size) != size)
+		return (false);
+	if (p->first[0] != 0 || p->first[n] != p->count)
+		return (false);
+	i = 0;
+	while (i < n)
+	{
+		if (p->first[i] > p->first[i + 1])
+			return (false);
+		i++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Reads the sets of a map from its cache file.
+ * @param map Pointer to the t_map structure, with `first` allocated.
+ * @param path Path of the .cub file.
+ * @return bool True if the file exists, matches the map and was read.
+ */
+bool	load_pvs_cache(t_map *map, const char *path)
+{
+	unsigned int	key[4];
+	unsigned int	head[5];
+	int				fd;
+	bool			ok;
+
+	fd = open_cache(path, O_RDONLY);
+	if (fd < 0)
+		return (false);
+	cache_key(map, key);
+	ok = read(fd, head, sizeof(head)) == sizeof(head)
+		&& ft_memcmp(head, key, sizeof(key)) == 0 && head[4] > 0
+		&& read_sets(fd, &map->pvs, map->width * map->height, head[4]);
+	close(fd);
+	if (!ok)
+	{
+		free(map->pvs.runs);
+		map->pvs.runs = NULL;
+		map->pvs.count = 0;
+	}
+	return (ok);
+}
+
+/**
+ * @brief Writes the sets of a map to its cache file. Failing to write it
+ * (e.g. a read-only directory) is not an error: the sets are simply built
+ * again next time.
+ * @param map Pointer to the t_map structure.
+ * @param path Path of the .cub file.
+ */
+void	save_pvs_cache(t_map *map, const char *path)
+{
+	unsigned int	head[5];
+	int				fd;
+
+	fd = open_cache(path, O_WRONLY | O_CREAT | O_TRUNC);
+	if (fd < 0)
+		return ;
+	cache_key(map, head);
+	head[4] = map->pvs.count;
+	if (write(fd, head, sizeof(head)) < 0
+		|| write(fd, map->pvs.first, (map->width * map->height + 1)
+			* sizeof(int)) < 0
+		|| write(fd, map->pvs.runs, map->pvs.count
+			* sizeof(unsigned short)) < 0)
+		ft_putstr_fd("Warning: could not write the pvs cache\n", 2);
+	close(fd);
+}
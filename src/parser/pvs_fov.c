@@ -0,0 +1,169 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pvs_fov.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:34:04 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:34:04 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file pvs_fov.c
+ * @brief Exact field of view of a tile, for the potentially visible sets.
+ * A tile is visible from another if some straight line from a point of
+ * one to a point of the other crosses no wall (precise permissive field of
+ * view). Each quadrant around the source tile is scanned diagonal by
+ * diagonal, outwards, keeping the wedges of it still in sight as views
+ * bounded by two lines through tile corners. A wall inside a view raises
+ * its shallow line, lowers its steep line, closes it or splits it in two;
+ * a line is only ever bent around the corner of a wall and pivoted on
+ * corners, never narrowed past what some line from the source tile gets
+ * through, so no visible tile is missed.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Splits the current view around a wall tile lying inside it: the
+ * copy below it has its steep line lowered under the wall, the original
+ * above it has its shallow line raised over it.
+ * @param f Pointer to the field of view state.
+ * @param x Column of the wall in the quadrant.
+ * @param y Row of the wall in the quadrant.
+ */
+static void	split_view(t_fov *f, int x, int y)
+{
+	ft_memmove(&f->views[f->view + 1], &f->views[f->view],
+		(f->view_count - f->view) * sizeof(t_fov_view));
+	f->view_count++;
+	fov_steep_bump(f, f->view, x + 1, y);
+	if (fov_check_view(f, f->view))
+		f->view++;
+	fov_shallow_bump(f, f->view, x, y + 1);
+	fov_check_view(f, f->view);
+}
+
+/**
+ * @brief Narrows the current view around a wall tile in it: closes it if
+ * the wall spans both of its lines, bends the line the wall crosses, or
+ * splits it if the wall lies between them.
+ * @param f Pointer to the field of view state.
+ * @param x Column of the wall in the quadrant.
+ * @param y Row of the wall in the quadrant.
+ */
+static void	block_view(t_fov *f, int x, int y)
+{
+	bool	on_shallow;
+	bool	on_steep;
+
+	on_shallow = fov_side(&f->views[f->view].shallow, x + 1, y) < 0;
+	on_steep = fov_side(&f->views[f->view].steep, x, y + 1) > 0;
+	if (on_shallow && on_steep)
+		fov_remove_view(f, f->view);
+	else if (on_shallow)
+	{
+		fov_shallow_bump(f, f->view, x, y + 1);
+		fov_check_view(f, f->view);
+	}
+	else if (on_steep)
+	{
+		fov_steep_bump(f, f->view, x + 1, y);
+		fov_check_view(f, f->view);
+	}
+	else
+		split_view(f, x, y);
+}
+
+/**
+ * @brief Visits a tile of the quadrant: finds the view it falls in, marks
+ * it as visible if there is one and narrows that view if the tile blocks
+ * sight. Doors (whatever their state), grates and low walls do not (see
+ * is_see_through).
+ * @param f Pointer to the field of view state.
+ * @param x Column of the tile in the quadrant.
+ * @param y Row of the tile in the quadrant.
+ */
+static void	visit(t_fov *f, int x, int y)
+{
+	int	tx;
+	int	ty;
+	int	i;
+
+	while (f->view < f->view_count
+		&& fov_side(&f->views[f->view].steep, x + 1, y) >= 0)
+		f->view++;
+	if (f->view == f->view_count
+		|| fov_side(&f->views[f->view].shallow, x, y + 1) <= 0)
+		return ;
+	tx = f->x + x * f->dx;
+	ty = f->y + y * f->dy;
+	i = ty * f->map->width + tx;
+	f->seen[i >> 6] |= 1ULL << (i & 63);
+	if (is_solid(f->map, tx, ty) && !is_see_through(f->map, tx, ty))
+		block_view(f, x, y);
+}
+
+/**
+ * @brief Scans one quadrant of the field of view, diagonal by diagonal,
+ * until the map edge or until every view is closed.
+ * @param f Pointer to the field of view state, with `dx` and `dy` set.
+ * @param ex Tiles between the source and the map edge along x.
+ * @param ey Tiles between the source and the map edge along y.
+ */
+static void	scan_quadrant(t_fov *f, int ex, int ey)
+{
+	int	i;
+	int	j;
+
+	ft_bzero(f->views, sizeof(t_fov_view));
+	f->views[0].shallow.yi = 1;
+	f->views[0].shallow.xf = ex;
+	f->views[0].steep.xi = 1;
+	f->views[0].steep.yf = ey;
+	f->views[0].shallow_bump = -1;
+	f->views[0].steep_bump = -1;
+	f->view_count = 1;
+	f->bump_count = 0;
+	i = 0;
+	while (++i <= ex + ey && f->view_count > 0)
+	{
+		j = (i - ex) * (i > ex);
+		f->view = 0;
+		while (j <= i && j <= ey && f->view < f->view_count)
+		{
+			visit(f, i - j, j);
+			j++;
+		}
+	}
+}
+
+/**
+ * @brief Marks in `f->seen` every tile visible from some point of a tile,
+ * the tile itself included.
+ * @param f Pointer to the field of view state, with `map`, `seen`, `views`
+ * and `bumps` set.
+ * @param x The column index of the tile.
+ * @param y The row index of the tile.
+ */
+void	tile_fov(t_fov *f, int x, int y)
+{
+	int	q;
+	int	i;
+
+	ft_bzero(f->seen, ((f->map->width * f->map->height + 63) >> 6) * 8);
+	i = y * f->map->width + x;
+	f->seen[i >> 6] |= 1ULL << (i & 63);
+	f->x = x;
+	f->y = y;
+	q = 0;
+	while (q < 4)
+	{
+		f->dx = 1 - 2 * (q & 1);
+		f->dy = 1 - 2 * (q >> 1);
+		scan_quadrant(f, x + (f->dx > 0) * (f->map->width - 1 - 2 * x),
+			y + (f->dy > 0) * (f->map->height - 1 - 2 * y));
+		q++;
+	}
+}
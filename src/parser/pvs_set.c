@@ -0,0 +1,161 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pvs_set.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:10:50 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 01:16:49 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file pvs_set.c
+ * @brief Tile sets of the potentially visible sets: one bit per tile,
+ * row-major, and their run-length encoding.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief ORs into `dst` the set `src` moved by `k` tiles in row-major
+ * order (towards higher indices if k > 0, lower ones if k < 0).
+ * @param dst Destination set.
+ * @param src Source set (not `dst`).
+ * @param words Number of words of both sets.
+ * @param k Shift, in tiles.
+ */
+static void	or_shifted(uint64_t *dst, uint64_t *src, int words, int k)
+{
+	int	q;
+	int	r;
+	int	i;
+
+	q = abs(k) >> 6;
+	r = abs(k) & 63;
+	i = 0;
+	while (i < words)
+	{
+		if (k > 0 && i - q >= 0)
+			dst[i] |= src[i - q] << r;
+		if (k > 0 && r && i - q - 1 >= 0)
+			dst[i] |= src[i - q - 1] >> (64 - r);
+		if (k < 0 && i + q < words)
+			dst[i] |= src[i + q] >> r;
+		if (k < 0 && r && i + q + 1 < words)
+			dst[i] |= src[i + q + 1] << (64 - r);
+		i++;
+	}
+}
+
+/**
+ * @brief Grows a set by one tile in all eight directions. A shift by one
+ * tile wraps from the end of a row to the start of the next, which only
+ * adds border tiles (walls of a closed map) and keeps the set a superset.
+ * @param seen Set to grow.
+ * @param tmp Scratch set of the same size.
+ * @param words Number of words of both sets.
+ * @param width Width of the map, the shift between rows.
+ */
+void	dilate_set(uint64_t *seen, uint64_t *tmp, int words, int width)
+{
+	ft_memcpy(tmp, seen, words * sizeof(uint64_t));
+	or_shifted(tmp, seen, words, 1);
+	or_shifted(tmp, seen, words, -1);
+	ft_memcpy(seen, tmp, words * sizeof(uint64_t));
+	or_shifted(seen, tmp, words, width);
+	or_shifted(seen, tmp, words, -width);
+}
+
+/**
+ * @brief Appends a run length to the encoded sets, doubling the buffer
+ * when it is full.
+ * @param p Pointer to the sets.
+ * @param len Run length.
+ * @return bool True on success, false on allocation failure.
+ */
+static bool	push_run(t_pvs *p, int len)
+{
+	unsigned short	*grown;
+
+	if (p->count == p->size)
+	{
+		grown = malloc(p->size * 2 * sizeof(unsigned short));
+		if (!grown)
+			return (false);
+		ft_memcpy(grown, p->runs, p->count * sizeof(unsigned short));
+		free(p->runs);
+		p->runs = grown;
+		p->size *= 2;
+	}
+	p->runs[p->count++] = len;
+	return (true);
+}
+
+/**
+ * @brief Run-length encodes a set of `n` tiles at the end of the encoded
+ * sets: alternating unseen and seen run lengths, starting with unseen.
+ * Whole words of the current state are taken 64 tiles at a time.
+ * @param p Pointer to the sets.
+ * @param seen Set to encode.
+ * @param n Number of tiles of the map (at most 65535).
+ * @return bool True on success, false on allocation failure.
+ */
+bool	encode_set(t_pvs *p, uint64_t *seen, int n)
+{
+	uint64_t	state;
+	int			len;
+	int			step;
+	int			i;
+
+	state = 0;
+	len = 0;
+	i = 0;
+	while (i < n)
+	{
+		step = 1;
+		if ((i & 63) == 0 && i + 64 <= n && seen[i >> 6] == 0 - state)
+			step = 64;
+		else if (((seen[i >> 6] >> (i & 63)) & 1) != state)
+		{
+			if (!push_run(p, len))
+				return (false);
+			state ^= 1;
+			len = 0;
+		}
+		len += step;
+		i += step;
+	}
+	return (push_run(p, len));
+}
+
+/**
+ * @brief Decodes the set of a tile into `p->seen`. A tile without a set
+ * (a wall) is given the full set, so nothing is culled from it.
+ * @param p Pointer to the sets.
+ * @param cell Index of the tile.
+ * @param n Number of tiles of the map.
+ */
+void	decode_set(t_pvs *p, int cell, int n)
+{
+	int	i;
+	int	pos;
+	int	len;
+
+	ft_memset(p->seen, 0xFF * (p->first[cell] == p->first[cell + 1]),
+		((n + 63) >> 6) * sizeof(uint64_t));
+	i = p->first[cell];
+	pos = 0;
+	while (i + 1 < p->first[cell + 1])
+	{
+		pos += p->runs[i];
+		len = p->runs[i + 1];
+		while (len-- > 0)
+		{
+			p->seen[pos >> 6] |= 1ULL << (pos & 63);
+			pos++;
+		}
+		i += 2;
+	}
+	p->cell = cell;
+}
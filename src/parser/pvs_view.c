@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pvs_view.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:34:04 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:34:04 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file pvs_view.c
+ * @brief Views of the field of view of pvs_fov.c: the wedges of a quadrant
+ * still in sight, the lines bounding them and the wall corners bending
+ * those lines. All coordinates are tile corners, so the tests are exact
+ * integer arithmetic.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Tells on which side of a line a corner lies.
+ * @param l The line.
+ * @param x Column of the corner.
+ * @param y Row of the corner.
+ * @return long Positive below the line, negative above it, 0 on it.
+ */
+long	fov_side(t_fov_line *l, int x, int y)
+{
+	return ((long)(l->yf - l->yi) * (l->xf - x)
+		- (long)(l->yf - y) * (l->xf - l->xi));
+}
+
+/**
+ * @brief Raises the shallow line of a view so that it passes over a wall
+ * corner, then pivots it on the corners already bending the steep line so
+ * that the view never narrows past what some point of the source tile can
+ * see.
+ * @param f Pointer to the field of view state.
+ * @param v Index of the view.
+ * @param x Column of the corner.
+ * @param y Row of the corner.
+ */
+void	fov_shallow_bump(t_fov *f, int v, int x, int y)
+{
+	t_fov_view	*w;
+	int			b;
+
+	w = &f->views[v];
+	w->shallow.xf = x;
+	w->shallow.yf = y;
+	f->bumps[f->bump_count].x = x;
+	f->bumps[f->bump_count].y = y;
+	f->bumps[f->bump_count].parent = w->shallow_bump;
+	w->shallow_bump = f->bump_count++;
+	b = w->steep_bump;
+	while (b >= 0)
+	{
+		if (fov_side(&w->shallow, f->bumps[b].x, f->bumps[b].y) < 0)
+		{
+			w->shallow.xi = f->bumps[b].x;
+			w->shallow.yi = f->bumps[b].y;
+		}
+		b = f->bumps[b].parent;
+	}
+}
+
+/**
+ * @brief Lowers the steep line of a view so that it passes under a wall
+ * corner, then pivots it on the corners bending the shallow line (see
+ * fov_shallow_bump).
+ * @param f Pointer to the field of view state.
+ * @param v Index of the view.
+ * @param x Column of the corner.
+ * @param y Row of the corner.
+ */
+void	fov_steep_bump(t_fov *f, int v, int x, int y)
+{
+	t_fov_view	*w;
+	int			b;
+
+	w = &f->views[v];
+	w->steep.xf = x;
+	w->steep.yf = y;
+	f->bumps[f->bump_count].x = x;
+	f->bumps[f->bump_count].y = y;
+	f->bumps[f->bump_count].parent = w->steep_bump;
+	w->steep_bump = f->bump_count++;
+	b = w->shallow_bump;
+	while (b >= 0)
+	{
+		if (fov_side(&w->steep, f->bumps[b].x, f->bumps[b].y) > 0)
+		{
+			w->steep.xi = f->bumps[b].x;
+			w->steep.yi = f->bumps[b].y;
+		}
+		b = f->bumps[b].parent;
+	}
+}
+
+/**
+ * @brief Removes a view; the views after it move down one slot.
+ * @param f Pointer to the field of view state.
+ * @param v Index of the view.
+ */
+void	fov_remove_view(t_fov *f, int v)
+{
+	ft_memmove(&f->views[v], &f->views[v + 1],
+		(f->view_count - v - 1) * sizeof(t_fov_view));
+	f->view_count--;
+}
+
+/**
+ * @brief Removes a view closed down to a single line through a corner of
+ * the source tile, which can no longer see past the walls bounding it.
+ * @param f Pointer to the field of view state.
+ * @param v Index of the view.
+ * @return bool True if the view is kept, false if it was removed.
+ */
+bool	fov_check_view(t_fov *f, int v)
+{
+	t_fov_line	*s;
+	t_fov_line	*t;
+
+	s = &f->views[v].shallow;
+	t = &f->views[v].steep;
+	if (fov_side(s, t->xi, t->yi) == 0 && fov_side(s, t->xf, t->yf) == 0
+		&& (fov_side(s, 0, 1) == 0 || fov_side(s, 1, 0) == 0))
+	{
+		fov_remove_view(f, v);
+		return (false);
+	}
+	return (true);
+}
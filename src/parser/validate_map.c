@@ -6,7 +6,7 @@
 /*   By: sergio-jimenez <sergio-jimenez@student.    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/21 10:05:52 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/11/29 20:09:17 by sergio-jime      ###   ########.fr       */
+/*   Updated: 2026/10/19 01:37:10 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -25,13 +25,17 @@
  * - ' ': Empty space (used outside the defined area, typically converted to
  * '0' during normalization).
  * - 'N', 'S', 'E', 'W': Player starting position and orientation.
+ * - '2' and up: A sprite standing on a floor tile (see is_sprite_char).
+ * - 'D': A door, solid while it is not fully open (see doors.c).
+ * - 'G': A grate or window, a wall that can be seen through.
  * @param c The character to validate.
  * @return bool True if the character is valid, false otherwise.
  */
 bool	is_valid_char(char c)
 {
 	return (c == '0' || c == '1' || c == ' '
-		|| c == 'N' || c == 'S' || c == 'E' || c == 'W');
+		|| c == 'N' || c == 'S' || c == 'E' || c == 'W'
+		|| c == 'D' || c == 'G' || is_sprite_char(c));
 }
 
 /**
@@ -77,10 +81,11 @@ static bool	validate_player_tile(t_map *map, int *count, int y, int x)
  * @param x The column index of the tile.
  * @return bool True if the tile is a wall ('1') or is safely located away
  * from the map edges, false otherwise.
+ * @note Walls are read from the occupancy grid (`is_solid`).
  */
 static bool	is_surrounded_by_walls(t_map *map, int y, int x)
 {
-	if (map->grid[y][x] == '1')
+	if (is_solid(map, x, y) && !ft_strchr("DG", map->grid[y][x]))
 		return (true);
 	if (y == 0 || y == map->height - 1)
 		return (false);
@@ -115,7 +120,7 @@ static bool	validate_tile(t_map *map, int *count, int y, int x)
 		return (ft_error("Invalid character in map\n"), false);
 	if (!validate_player_tile(map, count, y, x))
 		return (false);
-	if (c == '0' || c == 'N' || c == 'S' || c == 'E' || c == 'W')
+	if (ft_strchr("0NSEWDG", c))
 	{
 		if (!is_surrounded_by_walls(map, y, x))
 			return (ft_error("Map is not closed\n"), false);
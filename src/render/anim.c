@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   anim.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:56:42 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:00:23 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file anim.c
+ * @brief Animated wall textures (see parse_anim.c for the map syntax).
+ * The whole strip of frames stays loaded, and so do its shaded copies:
+ * the frames are stacked vertically, so each one is a contiguous block of
+ * rows, and a frame is only a view (a t_img with its own data pointer and
+ * height) into the strip. Picking the frame to draw is an index from the
+ * frame clock; nothing is reloaded or copied at runtime. Each frame view is
+ * a distinct image, so the column cache tells frames apart too.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Prints the memory an animated texture keeps resident: the strip,
+ * its shaded copies and the views.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param i Index of the wall texture.
+ */
+static void	print_anim_memory(t_cub3d *cub, int i)
+{
+	t_anim	*a;
+	long	strip;
+	long	shaded;
+
+	a = &cub->map.anims[i];
+	strip = (long)cub->textures[i].line_len * cub->textures[i].height;
+	shaded = 0;
+	if (cub->shades)
+		shaded = strip * SHADE_LEVELS;
+	printf("anim: texture %d, %d frames of %dx%d at %d fps, %ld KB strip, "
+		"%ld KB shaded, %ld KB views\n", i, a->count, cub->textures[i].width,
+		cub->textures[i].height / a->count, a->fps, strip / 1024,
+		shaded / 1024,
+		a->count * (SHADE_LEVELS + 1) * (long)sizeof(t_img) / 1024);
+}
+
+/**
+ * @brief Builds the frame views of one animated wall texture, and of its
+ * shaded copies when there are any.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param i Index of the wall texture.
+ * @return bool True on success, false if the strip does not split into
+ * its frames or on allocation failure.
+ */
+static bool	init_anim(t_cub3d *cub, int i)
+{
+	t_anim	*a;
+	t_img	*v;
+	int		n;
+
+	a = &cub->map.anims[i];
+	if (cub->textures[i].height % a->count)
+		return (ft_error("Animated texture not a strip of its frames\n"),
+			false);
+	a->views = malloc(a->count * (SHADE_LEVELS + 1) * sizeof(t_img));
+	if (!a->views)
+		return (ft_error("Malloc failed\n"), false);
+	n = 0;
+	while (n < a->count * (SHADE_LEVELS + 1))
+	{
+		v = &a->views[n];
+		*v = cub->textures[i];
+		if (cub->shades && n % (SHADE_LEVELS + 1))
+			*v = cub->shades[i * SHADE_LEVELS + n % (SHADE_LEVELS + 1) - 1];
+		v->img_ptr = NULL;
+		v->height /= a->count;
+		v->data += (long)(n / (SHADE_LEVELS + 1)) * v->height * v->line_len;
+		n++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Builds the frame views of the animated wall textures. Must run
+ * after the textures are loaded and shaded.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @return bool True on success, false on error.
+ */
+bool	init_anims(t_cub3d *cub)
+{
+	int	i;
+
+	i = 0;
+	while (i < 4)
+	{
+		if (cub->map.anims[i].count && !init_anim(cub, i))
+			return (false);
+		if (cub->map.anims[i].count && RENDER_STATS)
+			print_anim_memory(cub, i);
+		i++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Frees the frame views. Safe on a partial `init_anims`.
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+void	free_anims(t_cub3d *cub)
+{
+	int	i;
+
+	i = 0;
+	while (i < 4)
+	{
+		free(cub->map.anims[i].views);
+		cub->map.anims[i].views = NULL;
+		i++;
+	}
+}
+
+/**
+ * @brief Frame of an animated wall texture to draw at the current frame
+ * clock; its shaded views follow it.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param i Index of the wall texture (its animation must have frames).
+ * @return t_img* The view of the frame in the unshaded strip.
+ */
+t_img	*anim_frame(t_cub3d *cub, int i)
+{
+	t_anim	*a;
+
+	a = &cub->map.anims[i];
+	return (&a->views[cub->clock * a->fps / ANIM_CLOCK_RATE % a->count
+			* (SHADE_LEVELS + 1)]);
+}
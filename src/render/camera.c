@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   camera.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:21:36 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/18 20:21:36 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file camera.c
+ * @brief Per-column camera ray tables: column offsets built once per
+ * resolution, ray directions and DDA deltas built once per frame.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Allocates the tables for the current screen width and fills the
+ * column offsets.
+ * Called by init_renderer, and again by camera_sweep if the screen width
+ * changed since.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @return bool True on success, false on allocation failure.
+ */
+bool	init_camera(t_cub3d *cub)
+{
+	t_camera	*cam;
+	int			x;
+
+	cam = &cub->camera;
+	free(cam->offset);
+	cam->width = cub->screen_width;
+	cam->offset = malloc(5 * cam->width * sizeof(double));
+	if (!cam->offset)
+		return (ft_error("Malloc failed\n"), false);
+	cam->dir_x = cam->offset + cam->width;
+	cam->dir_y = cam->dir_x + cam->width;
+	cam->delta_x = cam->dir_y + cam->width;
+	cam->delta_y = cam->delta_x + cam->width;
+	x = 0;
+	while (x < cam->width)
+	{
+		cam->offset[x] = 2.0 * column_sample(cub, x) / (double)cam->width
+			- 1.0;
+		x++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Fills the deltas of the whole screen from the ray directions.
+ * A null component gets a huge delta so that the ray never steps along
+ * that axis.
+ * @param d Direction components.
+ * @param delta Deltas to fill.
+ * @param n Number of columns.
+ */
+static void	sweep_deltas(double *d, double *delta, int n)
+{
+	int	x;
+
+	x = 0;
+	while (x < n)
+	{
+		if (d[x] == 0)
+			delta[x] = 1e30;
+		else
+			delta[x] = fabs(1.0 / d[x]);
+		x++;
+	}
+}
+
+/**
+ * @brief Builds the ray direction and DDA deltas of every column from the
+ * player's direction and camera plane. Called once at the start of every
+ * frame; init_ray_vars then only reads the tables.
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+void	camera_sweep(t_cub3d *cub)
+{
+	t_camera	*cam;
+	t_player	*p;
+	int			x;
+
+	cam = &cub->camera;
+	if (cam->width != cub->screen_width && !init_camera(cub))
+		cleanup_and_exit(cub, 1);
+	p = &cub->player;
+	x = 0;
+	while (x < cam->width)
+	{
+		cam->dir_x[x] = p->dir_x - p->plane_x * cam->offset[x];
+		cam->dir_y[x] = p->dir_y - p->plane_y * cam->offset[x];
+		x++;
+	}
+	sweep_deltas(cam->dir_x, cam->delta_x, cam->width);
+	sweep_deltas(cam->dir_y, cam->delta_y, cam->width);
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   column_cache.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:45:09 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:42:21 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file column_cache.c
+ * @brief Lookup and insertion in the LRU cache of pre-scaled wall columns.
+ * Entries are keyed by (texture, tex_x, line_h): for a given screen height
+ * that triple fully determines the visible pixels of a wall line. No entry
+ * depends on the map layout, so the cache stays valid when doors move and
+ * ignores the map version.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Frees the least recently used entry, unlinking it from both the
+ * LRU list and its hash chain.
+ * @param c Pointer to the column cache.
+ */
+static void	evict_oldest(t_col_cache *c)
+{
+	t_col_entry	*e;
+	t_col_entry	**link;
+
+	e = c->oldest;
+	lru_unlink(c, e);
+	link = &c->buckets[col_cache_bucket(e->tex, e->tex_x, e->line_h)];
+	while (*link && *link != e)
+		link = &(*link)->next;
+	if (*link)
+		*link = e->next;
+	c->used -= sizeof(t_col_entry) + e->len * sizeof(unsigned int);
+	c->evictions++;
+	free(e);
+}
+
+/**
+ * @brief Allocates an entry and its pixel run in one block and fills
+ * its key.
+ * @param r Projected ray holding the key and the visible range.
+ * @param size Total size of the block in bytes.
+ * @return t_col_entry* The new entry, or NULL on malloc failure.
+ */
+static t_col_entry	*new_entry(t_ray *r, size_t size)
+{
+	t_col_entry	*e;
+
+	e = malloc(size);
+	if (!e)
+		return (NULL);
+	e->pixels = (unsigned int *)(e + 1);
+	e->tex = r->tex;
+	e->tex_x = r->tex_x;
+	e->line_h = r->line_h;
+	e->len = r->end - r->start + 1;
+	return (e);
+}
+
+/**
+ * @brief Looks up the pre-scaled column for a projected ray.
+ * On a hit the entry becomes the most recently used one.
+ * @param c Pointer to the column cache.
+ * @param r Projected ray (tex, tex_x and line_h set).
+ * @param run Receives the cached pixel run on a hit.
+ * @return bool True on a hit.
+ */
+bool	col_cache_find(t_col_cache *c, t_ray *r, unsigned int **run)
+{
+	t_col_entry	*e;
+
+	e = c->buckets[col_cache_bucket(r->tex, r->tex_x, r->line_h)];
+	while (e && (e->tex != r->tex || e->tex_x != r->tex_x
+			|| e->line_h != r->line_h))
+		e = e->next;
+	if (!e)
+	{
+		c->misses++;
+		return (false);
+	}
+	c->hits++;
+	lru_unlink(c, e);
+	lru_push_front(c, e);
+	*run = e->pixels;
+	return (true);
+}
+
+/**
+ * @brief Adds an entry for a projected ray, first evicting the least
+ * recently used entries until it fits in the budget.
+ * The caller fills the returned run (end - start + 1 pixels).
+ * @param c Pointer to the column cache.
+ * @param r Projected ray (tex, tex_x, line_h, start and end set).
+ * @param run Receives the pixel run of the new entry.
+ * @return bool False if the run alone exceeds the budget or malloc failed.
+ */
+bool	col_cache_insert(t_col_cache *c, t_ray *r, unsigned int **run)
+{
+	t_col_entry	*e;
+	size_t		size;
+	int			bucket;
+
+	size = sizeof(t_col_entry) + (r->end - r->start + 1) * sizeof(int);
+	if (size > c->budget)
+		return (false);
+	while (c->oldest && c->used + size > c->budget)
+		evict_oldest(c);
+	e = new_entry(r, size);
+	if (!e)
+		return (false);
+	bucket = col_cache_bucket(r->tex, r->tex_x, r->line_h);
+	e->next = c->buckets[bucket];
+	c->buckets[bucket] = e;
+	lru_push_front(c, e);
+	c->used += size;
+	*run = e->pixels;
+	return (true);
+}
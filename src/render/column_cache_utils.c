@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   column_cache_utils.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:58:26 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/18 17:58:26 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file column_cache_utils.c
+ * @brief Setup, teardown, hashing and LRU list helpers of the pre-scaled
+ * wall column cache.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Allocates the hash buckets and sets the memory budget.
+ * With a budget of 0 the cache stays disabled and nothing is allocated.
+ * @param c Pointer to the column cache.
+ * @return bool True on success, false on allocation failure.
+ */
+bool	init_column_cache(t_col_cache *c)
+{
+	c->budget = COLUMN_CACHE_BUDGET;
+	if (c->budget == 0)
+		return (true);
+	c->buckets = ft_calloc(COLUMN_CACHE_BUCKETS, sizeof(t_col_entry *));
+	if (!c->buckets)
+		return (ft_error("Malloc failed\n"), false);
+	return (true);
+}
+
+/**
+ * @brief Frees every cached column and the hash buckets.
+ * @param c Pointer to the column cache.
+ */
+void	free_column_cache(t_col_cache *c)
+{
+	t_col_entry	*e;
+
+	while (c->newest)
+	{
+		e = c->newest;
+		c->newest = e->older;
+		free(e);
+	}
+	c->oldest = NULL;
+	c->used = 0;
+	free(c->buckets);
+	c->buckets = NULL;
+}
+
+/**
+ * @brief Removes an entry from the LRU list.
+ * @param c Pointer to the column cache.
+ * @param e Entry to unlink.
+ */
+void	lru_unlink(t_col_cache *c, t_col_entry *e)
+{
+	if (e->newer)
+		e->newer->older = e->older;
+	else
+		c->newest = e->older;
+	if (e->older)
+		e->older->newer = e->newer;
+	else
+		c->oldest = e->newer;
+	e->newer = NULL;
+	e->older = NULL;
+}
+
+/**
+ * @brief Inserts an entry at the most recently used end of the LRU list.
+ * @param c Pointer to the column cache.
+ * @param e Entry to insert (must not be linked).
+ */
+void	lru_push_front(t_col_cache *c, t_col_entry *e)
+{
+	e->newer = NULL;
+	e->older = c->newest;
+	if (c->newest)
+		c->newest->newer = e;
+	c->newest = e;
+	if (!c->oldest)
+		c->oldest = e;
+}
+
+/**
+ * @brief Hash bucket of a (texture, tex_x, line_h) key.
+ * @param tex Texture of the column.
+ * @param tex_x Texture column.
+ * @param line_h Projected wall height.
+ * @return int Bucket index in [0, COLUMN_CACHE_BUCKETS).
+ */
+int	col_cache_bucket(t_img *tex, int tex_x, int line_h)
+{
+	unsigned long	h;
+
+	h = (unsigned long)tex >> 4;
+	h = h * 31 + (unsigned int)tex_x;
+	h = h * 2654435761u + (unsigned int)line_h;
+	h ^= h >> 15;
+	return ((int)(h % COLUMN_CACHE_BUCKETS));
+}
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dda_fixed.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 21:19:27 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/18 00:24:08 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file dda_fixed.c
+ * @brief 16.16 fixed-point DDA kernel (DDA_PRECISION == DDA_FIXED).
+ * Same traversal and empty-space skipping as perform_dda, on integers:
+ * distances have 16 fractional bits and deltas are capped at
+ * DDA_FIX_MAX_DELTA so that sums never overflow 64 bits.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Fixed-point version of the leap limit: grid lines of one axis
+ * crossed strictly before the distance `t`, capped at `max`.
+ */
+static int	crossings_x(int64_t side, int64_t delta, int64_t t, int max)
+{
+	int64_t	n;
+
+	if (side >= t)
+		return (0);
+	n = (t - side + delta - 1) / delta;
+	if (n > max)
+		return (max);
+	return ((int)n);
+}
+
+/**
+ * @brief Advances the ray through empty tiles, crossing at most `reach_x`
+ * vertical and `reach_y` horizontal grid lines (see leap in dda_skip.c).
+ */
+static void	leap_x(t_ray *r, t_dda_x *d, int reach_x, int reach_y)
+{
+	int		kx;
+	int		ky;
+	int64_t	t;
+
+	t = d->side_x + reach_x * d->delta_x;
+	if (d->side_y + reach_y * d->delta_y < t)
+		t = d->side_y + reach_y * d->delta_y;
+	kx = crossings_x(d->side_x, d->delta_x, t, reach_x);
+	ky = crossings_x(d->side_y, d->delta_y, t, reach_y);
+	r->map_x += kx * r->step_x;
+	d->side_x += kx * d->delta_x;
+	r->map_y += ky * r->step_y;
+	d->side_y += ky * d->delta_y;
+}
+
+/**
+ * @brief Fixed-point version of skip_empty_space.
+ */
+static void	skip_x(t_map *map, t_ray *r, t_dda_x *d)
+{
+	int	reach;
+
+	reach = map->dist[r->map_y * map->width + r->map_x] - 1;
+	if (reach >= SKIP_MIN_DIST - 1)
+		leap_x(r, d, reach, reach);
+	else if (is_block_empty(map, r->map_x >> 3, r->map_y >> 3))
+		leap_x(r, d, block_reach(r->map_x, r->step_x),
+			block_reach(r->map_y, r->step_y));
+}
+
+/**
+ * @brief Converts one axis of the ray to fixed point: the delta (capped)
+ * and the distance to the first grid line.
+ * @param pos Player coordinate on that axis.
+ * @param dir Ray direction component on that axis.
+ * @param cell Tile coordinate on that axis.
+ * @param delta Receives the delta; the side distance is returned.
+ */
+static int64_t	init_axis_x(double pos, double dir, int cell, int64_t *delta)
+{
+	int64_t	frac;
+
+	*delta = DDA_FIX_MAX_DELTA;
+	if (fabs(dir) * DDA_FIX_MAX_DELTA > DDA_FIX_ONE)
+		*delta = (int64_t)(DDA_FIX_ONE / fabs(dir));
+	frac = (int64_t)((pos - cell) * DDA_FIX_ONE);
+	if (dir >= 0)
+		frac = DDA_FIX_ONE - frac;
+	if (frac < 1)
+		frac = 1;
+	return ((frac * *delta) >> 16);
+}
+
+/**
+ * @brief Fixed-point DDA: steps the ray until it enters a solid tile or
+ * passes VIEW_DISTANCE, leaving map_x, map_y, side and hit as perform_dda
+ * does.
+ * @param map Pointer to the t_map structure.
+ * @param p Pointer to the player (ray origin).
+ * @param r Ray set up by init_ray_vars.
+ */
+void	dda_fixed(t_map *map, t_player *p, t_ray *r)
+{
+	t_dda_x	d;
+
+	d.side_x = init_axis_x(p->x, r->dir_x, r->map_x, &d.delta_x);
+	d.side_y = init_axis_x(p->y, r->dir_y, r->map_y, &d.delta_y);
+	r->hit = 0;
+	while (!r->hit)
+	{
+		skip_x(map, r, &d);
+		if (d.side_x < d.side_y)
+		{
+			d.side_x += d.delta_x;
+			r->map_x += r->step_x;
+			r->side = 0;
+		}
+		else
+		{
+			d.side_y += d.delta_y;
+			r->map_y += r->step_y;
+			r->side = 1;
+		}
+		r->hit = is_solid(map, r->map_x, r->map_y);
+		if (VIEW_DISTANCE > 0 && !r->hit && (d.side_x >> 16) >= VIEW_DISTANCE
+			&& (d.side_y >> 16) >= VIEW_DISTANCE)
+			break ;
+	}
+}
@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dda_float.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 21:04:52 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/18 00:24:08 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file dda_float.c
+ * @brief Single-precision DDA kernel (DDA_PRECISION == DDA_FLOAT).
+ * Same traversal and empty-space skipping as perform_dda, with the side
+ * and delta distances kept in floats, relative to the player's tile and
+ * rebased as the ray advances.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Float version of the leap limit: grid lines of one axis crossed
+ * strictly before the distance `t`, capped at `max`.
+ */
+static int	crossings_f(float side, float delta, float t, int max)
+{
+	float	n;
+
+	if (side >= t)
+		return (0);
+	n = ceilf((t - side) / delta);
+	if (n > max)
+		return (max);
+	return ((int)n);
+}
+
+/**
+ * @brief Advances the ray through empty tiles, crossing at most `reach_x`
+ * vertical and `reach_y` horizontal grid lines (see leap in dda_skip.c).
+ */
+static void	leap_f(t_ray *r, t_dda_f *d, int reach_x, int reach_y)
+{
+	int		kx;
+	int		ky;
+	float	t;
+
+	t = fminf(d->side_x + reach_x * d->delta_x,
+			d->side_y + reach_y * d->delta_y);
+	kx = crossings_f(d->side_x, d->delta_x, t, reach_x);
+	ky = crossings_f(d->side_y, d->delta_y, t, reach_y);
+	r->map_x += kx * r->step_x;
+	d->side_x += kx * d->delta_x;
+	r->map_y += ky * r->step_y;
+	d->side_y += ky * d->delta_y;
+}
+
+/**
+ * @brief Rebases the side distances, then skips empty space like
+ * skip_empty_space.
+ * Only the order of side_x and side_y matters to the traversal, so the
+ * smaller one is subtracted from both: the accumulators stay within one
+ * delta of zero instead of growing with the distance travelled, and keep
+ * their fractional precision however far the ray goes.
+ */
+static void	skip_f(t_map *map, t_ray *r, t_dda_f *d)
+{
+	float	base;
+	int		reach;
+
+	base = fminf(d->side_x, d->side_y);
+	d->side_x -= base;
+	d->side_y -= base;
+	d->travel += base;
+	reach = map->dist[r->map_y * map->width + r->map_x] - 1;
+	if (reach >= SKIP_MIN_DIST - 1)
+		leap_f(r, d, reach, reach);
+	else if (is_block_empty(map, r->map_x >> 3, r->map_y >> 3))
+		leap_f(r, d, block_reach(r->map_x, r->step_x),
+			block_reach(r->map_y, r->step_y));
+}
+
+/**
+ * @brief Sets up the float traversal state from the player position and
+ * the ray prepared by init_ray_vars (tile, direction and steps).
+ * The origin is rebased on the player's tile: the offset inside the tile
+ * is taken in double before the conversion, so it keeps full float
+ * precision on maps of any size.
+ */
+static void	init_dda_f(t_player *p, t_ray *r, t_dda_f *d)
+{
+	float	fx;
+	float	fy;
+
+	d->delta_x = 1e30f;
+	if (r->dir_x != 0)
+		d->delta_x = fabsf(1.0f / (float)r->dir_x);
+	d->delta_y = 1e30f;
+	if (r->dir_y != 0)
+		d->delta_y = fabsf(1.0f / (float)r->dir_y);
+	fx = (float)(p->x - r->map_x);
+	if (r->step_x > 0)
+		fx = 1.0f - fx;
+	fy = (float)(p->y - r->map_y);
+	if (r->step_y > 0)
+		fy = 1.0f - fy;
+	d->side_x = fmaxf(fx, 1e-6f) * d->delta_x;
+	d->side_y = fmaxf(fy, 1e-6f) * d->delta_y;
+	d->travel = 0;
+}
+
+/**
+ * @brief Float DDA: steps the ray until it enters a solid tile or passes
+ * VIEW_DISTANCE, leaving map_x, map_y, side and hit as perform_dda does.
+ * @param map Pointer to the t_map structure.
+ * @param p Pointer to the player (ray origin).
+ * @param r Ray set up by init_ray_vars.
+ */
+void	dda_float(t_map *map, t_player *p, t_ray *r)
+{
+	t_dda_f	d;
+
+	init_dda_f(p, r, &d);
+	r->hit = 0;
+	while (!r->hit)
+	{
+		skip_f(map, r, &d);
+		if (d.side_x < d.side_y)
+		{
+			d.side_x += d.delta_x;
+			r->map_x += r->step_x;
+			r->side = 0;
+		}
+		else
+		{
+			d.side_y += d.delta_y;
+			r->map_y += r->step_y;
+			r->side = 1;
+		}
+		r->hit = is_solid(map, r->map_x, r->map_y);
+		if (VIEW_DISTANCE > 0 && !r->hit
+			&& d.travel + fminf(d.side_x, d.side_y) > VIEW_DISTANCE)
+			break ;
+	}
+}
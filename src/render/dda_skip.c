@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dda_skip.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:40:52 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/18 23:55:51 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file dda_skip.c
+ * @brief Empty-space skipping for the DDA traversal.
+ * Before each DDA step the ray reads the distance field of the tile it is in.
+ * When the nearest wall is at least SKIP_MIN_DIST tiles away, the whole square
+ * of radius (dist - 1) around that tile is known to be empty, so the ray jumps
+ * straight to the last tile it would reach inside the square instead of
+ * stepping (and testing the map) cell by cell. Exact DDA takes over again as
+ * soon as the ray gets close to a wall, so hits are the same.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Counts the grid lines of one axis that the ray crosses strictly
+ * before reaching the distance `t`, capped at `max`.
+ * @param side Distance along the ray to the next grid line of that axis.
+ * @param delta Distance along the ray between two grid lines of that axis.
+ * @param t Distance along the ray where the leap stops.
+ * @param max Maximum number of lines the ray may cross on that axis.
+ * @return int The number of crossings.
+ */
+static int	crossings_before(double side, double delta, double t, int max)
+{
+	double	n;
+
+	if (side >= t)
+		return (0);
+	n = ceil((t - side) / delta);
+	if (n > max)
+		return (max);
+	return ((int)n);
+}
+
+/**
+ * @brief Advances the ray through empty tiles, crossing at most `reach_x`
+ * vertical and `reach_y` horizontal grid lines.
+ * The leap ends right before the first crossing that would exceed either
+ * limit; the ray state (tile and side distances) is left as the DDA would
+ * have left it there.
+ * @param r Pointer to the ray being traversed.
+ * @param reach_x Grid lines the ray may cross on the X axis.
+ * @param reach_y Grid lines the ray may cross on the Y axis.
+ */
+static void	leap(t_ray *r, int reach_x, int reach_y)
+{
+	int		kx;
+	int		ky;
+	double	t;
+
+	t = fmin(r->side_x + reach_x * r->delta_x,
+			r->side_y + reach_y * r->delta_y);
+	kx = crossings_before(r->side_x, r->delta_x, t, reach_x);
+	ky = crossings_before(r->side_y, r->delta_y, t, reach_y);
+	r->map_x += kx * r->step_x;
+	r->side_x += kx * r->delta_x;
+	r->map_y += ky * r->step_y;
+	r->side_y += ky * r->delta_y;
+}
+
+/**
+ * @brief Number of tiles left before the edge of the current 8x8 block,
+ * in the direction of travel.
+ * @param cell Tile coordinate on one axis.
+ * @param step Direction of travel on that axis (+1 or -1).
+ * @return int Grid lines the ray can cross while staying in the block.
+ */
+int	block_reach(int cell, int step)
+{
+	if (step > 0)
+		return (7 - (cell & 7));
+	return (cell & 7);
+}
+
+/**
+ * @brief Advances the ray across the known-empty area around its tile.
+ * With `reach` = dist - 1, the square of that radius around the tile is
+ * empty and the ray may cross up to `reach` grid lines on each axis. Near
+ * walls, where the distance field gives nothing, the ray can still cross the
+ * rest of its 8x8 block when the occupancy grid reports that block empty.
+ * @param map Pointer to the t_map structure holding the distance field.
+ * @param r Pointer to the ray being traversed.
+ */
+void	skip_empty_space(t_map *map, t_ray *r)
+{
+	int	reach;
+
+	reach = map->dist[r->map_y * map->width + r->map_x] - 1;
+	if (reach >= SKIP_MIN_DIST - 1)
+		leap(r, reach, reach);
+	else if (is_block_empty(map, r->map_x >> 3, r->map_y >> 3))
+		leap(r, block_reach(r->map_x, r->step_x),
+			block_reach(r->map_y, r->step_y));
+}
@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dda_validate.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 21:37:10 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 01:48:53 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file dda_validate.c
+ * @brief Selection of the DDA kernel and validation of the float and
+ * fixed-point kernels against the double precision reference.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Picks the DDA kernel for the loaded map: DDA_PRECISION, unless
+ * the map is larger than what that kernel is trusted with, or has doors,
+ * grates or wall heights (only the double kernel tests door panels and
+ * stores layers), in which case the double kernel is used.
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+void	select_dda(t_cub3d *cub)
+{
+	int	size;
+
+	size = cub->map.width;
+	if (cub->map.height > size)
+		size = cub->map.height;
+	cub->dda_precision = DDA_PRECISION;
+	if ((DDA_PRECISION == DDA_FLOAT && size > DDA_FLOAT_MAX_MAP)
+		|| (DDA_PRECISION == DDA_FIXED && size > DDA_FIXED_MAX_MAP)
+		|| cub->map.doors || cub->map.grates || cub->map.heights)
+		cub->dda_precision = DDA_DOUBLE;
+}
+
+/**
+ * @brief xorshift32 step; returns a value in [0, 1).
+ */
+static double	next_random(unsigned int *seed)
+{
+	*seed ^= *seed << 13;
+	*seed ^= *seed >> 17;
+	*seed ^= *seed << 5;
+	return (*seed / 4294967296.0);
+}
+
+/**
+ * @brief Sets up a ray from a random point of a random empty tile in a
+ * random direction, as init_ray_vars would.
+ */
+static void	random_ray(t_map *map, t_player *p, t_ray *r, unsigned int *seed)
+{
+	double	angle;
+
+	r->map_x = -1;
+	r->map_y = -1;
+	while (is_solid(map, r->map_x, r->map_y))
+	{
+		r->map_x = (int)(next_random(seed) * map->width);
+		r->map_y = (int)(next_random(seed) * map->height);
+	}
+	p->x = r->map_x + next_random(seed);
+	p->y = r->map_y + next_random(seed);
+	angle = next_random(seed) * 2.0 * M_PI;
+	r->dir_x = cos(angle);
+	r->dir_y = sin(angle);
+	r->delta_x = fabs(1.0 / r->dir_x);
+	r->delta_y = fabs(1.0 / r->dir_y);
+	calc_step_side(p, r);
+}
+
+/**
+ * @brief Traces a ray with the double kernel and with `variant`, and tells
+ * whether both hit the same face of the same tile.
+ */
+static bool	same_hit(t_cub3d *cub, t_player *p, t_ray *r, int variant)
+{
+	t_ray	ref;
+	t_ray	test;
+
+	ref = *r;
+	test = *r;
+	perform_dda(cub, &ref);
+	if (variant == DDA_FLOAT)
+		dda_float(&cub->map, p, &test);
+	else
+		dda_fixed(&cub->map, p, &test);
+	return (ref.map_x == test.map_x && ref.map_y == test.map_y
+		&& ref.side == test.side);
+}
+
+/**
+ * @brief Compares the float and fixed-point kernels with the double one
+ * over DDA_VALIDATE_RAYS random rays of the loaded map and prints their
+ * mismatch rates. Run at start-up by RENDER_STATS builds.
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+void	validate_dda(t_cub3d *cub)
+{
+	t_player		p;
+	t_ray			r;
+	long			miss[2];
+	long			i;
+	unsigned int	seed;
+
+	seed = 2463534242u;
+	miss[0] = 0;
+	miss[1] = 0;
+	i = 0;
+	while (i++ < DDA_VALIDATE_RAYS)
+	{
+		random_ray(&cub->map, &p, &r, &seed);
+		miss[0] += !same_hit(cub, &p, &r, DDA_FLOAT);
+		miss[1] += !same_hit(cub, &p, &r, DDA_FIXED);
+	}
+	printf("dda validation (%dx%d map, %d rays): float %ld mismatches "
+		"(%.4f%%), fixed 16.16 %ld mismatches (%.4f%%)\n", cub->map.width,
+		cub->map.height, DDA_VALIDATE_RAYS, miss[0],
+		100.0 * miss[0] / DDA_VALIDATE_RAYS, miss[1],
+		100.0 * miss[1] / DDA_VALIDATE_RAYS);
+}
@@ -0,0 +1,151 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   doors.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:22:40 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 01:28:37 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file doors.c
+ * @brief Sliding doors: ray test against the panel, use key and animation.
+ * A door tile is solid until its door is fully open, so the DDA stops on
+ * it like on a wall; the ray then crosses the tile and only hits if it
+ * meets the panel, in the middle of the tile, on the part the door has
+ * not slid away from. Otherwise the walk goes on.
+ * Moving a door only changes its `open` offset. The layout (occupancy,
+ * distance field, ray cache) is touched when the tile turns passable, as
+ * the door finishes opening, and when it turns solid again, as it starts
+ * closing.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Distance along a ray to the panel plane of a door, and where
+ * across the tile it meets it.
+ * @param p Ray origin (the player).
+ * @param r Ray.
+ * @param d Door.
+ * @param u Returned position across the tile, 0 to 1 in the direction of
+ * the axis along the panel.
+ * @return double Distance in ray units (like side_x and side_y), negative
+ * if the ray runs parallel to the panel.
+ */
+static double	panel_depth(t_player *p, t_ray *r, t_door *d, double *u)
+{
+	double	t;
+
+	if ((d->side == 0 && r->dir_x == 0) || (d->side == 1 && r->dir_y == 0))
+		return (-1);
+	if (d->side == 0)
+	{
+		t = (d->x + 0.5 - p->x) / r->dir_x;
+		*u = p->y + t * r->dir_y - d->y;
+	}
+	else
+	{
+		t = (d->y + 0.5 - p->y) / r->dir_y;
+		*u = p->x + t * r->dir_x - d->x;
+	}
+	return (t);
+}
+
+/**
+ * @brief Called by the DDA when the ray steps into a solid tile: tells
+ * whether the walk ends there. Walls always stop it. In a door tile the
+ * ray is stopped only if it meets the panel before leaving the tile, in
+ * which case `door` and `side` are set to the door and its panel.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param r Ray, just stepped into the tile.
+ * @return bool True if the ray hits something in this tile.
+ */
+bool	door_blocks(t_cub3d *cub, t_ray *r)
+{
+	t_door	*d;
+	double	t;
+	double	t_in;
+	double	u;
+
+	if (!is_door(&cub->map, r->map_x, r->map_y))
+		return (true);
+	r->transient = true;
+	u = 0;
+	d = &cub->map.doors[cub->map.door_of[r->map_y * cub->map.width
+			+ r->map_x]];
+	t_in = r->side_y - r->delta_y;
+	if (r->side == 0)
+		t_in = r->side_x - r->delta_x;
+	t = panel_depth(&cub->player, r, d, &u);
+	if (t < t_in || t > fmin(r->side_x, r->side_y) || u < d->open)
+		return (false);
+	r->door = d - cub->map.doors;
+	r->side = d->side;
+	return (true);
+}
+
+/**
+ * @brief Moves a door by DOOR_SPEED in the direction it is moving. It
+ * stops at the end of its travel; its tile becomes passable when it is
+ * fully open and solid again as soon as it starts closing, which waits
+ * while the player overlaps the tile (with the wall margin).
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param d Moving door.
+ */
+static void	step_door(t_cub3d *cub, t_door *d)
+{
+	if (d->move < 0 && d->open >= 1)
+	{
+		if (fabs(cub->player.x - (d->x + 0.5)) < 0.5 + WALL_MARGIN
+			&& fabs(cub->player.y - (d->y + 0.5)) < 0.5 + WALL_MARGIN)
+			return ;
+		set_tile_solid(&cub->map, d->x, d->y, true);
+	}
+	d->open = fmin(fmax(d->open + d->move * DOOR_SPEED, 0), 1);
+	if (d->open == 0 || d->open == 1)
+		d->move = 0;
+	if (d->open == 1)
+		set_tile_solid(&cub->map, d->x, d->y, false);
+}
+
+/**
+ * @brief Use key: starts opening the door in front of the player, or
+ * closing it if it is open or opening.
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+void	toggle_door(t_cub3d *cub)
+{
+	t_door	*d;
+	int		x;
+	int		y;
+
+	x = (int)(cub->player.x + cub->player.dir_x * DOOR_REACH);
+	y = (int)(cub->player.y + cub->player.dir_y * DOOR_REACH);
+	if (!is_door(&cub->map, x, y))
+		return ;
+	d = &cub->map.doors[cub->map.door_of[y * cub->map.width + x]];
+	if (d->move > 0 || (d->move == 0 && d->open >= 1))
+		d->move = -1;
+	else
+		d->move = 1;
+}
+
+/**
+ * @brief Animates the doors, once per frame.
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+void	update_doors(t_cub3d *cub)
+{
+	int	i;
+
+	i = 0;
+	while (i < cub->map.door_count)
+	{
+		if (cub->map.doors[i].move != 0)
+			step_door(cub, &cub->map.doors[i]);
+		i++;
+	}
+}
@@ -0,0 +1,167 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dyn_light.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:10:44 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:19:32 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file dyn_light.c
+ * @brief Moving point lights on an incrementally updated per-tile grid.
+ * A light adds to every open tile within its radius that it can see (grid
+ * DDA from the light to the tile center). Moving a light only recomputes
+ * the tiles around its old and new positions; contributions are integers,
+ * so removing one subtracts exactly what was added. A tile changing
+ * solidity (a door) changes what the lights around it add, so those are
+ * removed before the change and added back after it (see relight_tile).
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Walks the grid from a light towards the center of tile (tx, ty)
+ * and tells whether it gets there without crossing a wall. The segment
+ * crosses exactly one tile boundary per step, so the walk is bounded by
+ * the Manhattan distance between both tiles.
+ * @param map Pointer to the t_map structure.
+ * @param from Position of the light.
+ * @param tx Target tile X.
+ * @param ty Target tile Y.
+ * @return bool True if the light sees the tile.
+ */
+static bool	tile_visible(t_map *map, t_player *from, int tx, int ty)
+{
+	t_ray	r;
+	int		n;
+
+	r.map_x = (int)from->x;
+	r.map_y = (int)from->y;
+	r.dir_x = tx + 0.5 - from->x;
+	r.dir_y = ty + 0.5 - from->y;
+	r.delta_x = fabs(1.0 / r.dir_x);
+	r.delta_y = fabs(1.0 / r.dir_y);
+	calc_step_side(from, &r);
+	n = abs(tx - r.map_x) + abs(ty - r.map_y);
+	while (n > 1 && !is_solid(map, r.map_x, r.map_y))
+	{
+		r.side = (r.side_x >= r.side_y);
+		if (r.side == 0)
+			r.side_x += r.delta_x;
+		else
+			r.side_y += r.delta_y;
+		r.map_x += r.step_x * (r.side == 0);
+		r.map_y += r.step_y * r.side;
+		n--;
+	}
+	return (n <= 1 && !is_solid(map, r.map_x, r.map_y));
+}
+
+/**
+ * @brief Brightness a light adds to tile (x, y): a quadratic falloff to
+ * zero at its radius, nothing for walls or tiles it cannot see.
+ * @return int Contribution in 1/256 units.
+ */
+static int	contrib(t_map *map, t_light *l, int x, int y)
+{
+	t_player	from;
+	double		dx;
+	double		dy;
+	double		d;
+
+	if (is_solid(map, x, y))
+		return (0);
+	dx = x + 0.5 - l->x;
+	dy = y + 0.5 - l->y;
+	d = sqrt(dx * dx + dy * dy);
+	if (d >= l->radius)
+		return (0);
+	from.x = l->x;
+	from.y = l->y;
+	if (!tile_visible(map, &from, x, y))
+		return (0);
+	return ((int)(256 * pow(1 - d / l->radius, 2)));
+}
+
+/**
+ * @brief Adds (sign 1) or removes (sign -1) a light from every tile of the
+ * square around it.
+ * @param map Pointer to the t_map structure.
+ * @param l Light.
+ * @param sign 1 or -1.
+ */
+void	apply_dyn_light(t_map *map, t_light *l, int sign)
+{
+	int	x;
+	int	y;
+	int	x_end;
+	int	y_end;
+
+	y = clamp((int)(l->y - l->radius), 0, map->height - 1);
+	y_end = clamp((int)(l->y + l->radius), 0, map->height - 1);
+	x_end = clamp((int)(l->x + l->radius), 0, map->width - 1);
+	while (y <= y_end)
+	{
+		x = clamp((int)(l->x - l->radius), 0, map->width - 1);
+		while (x <= x_end)
+		{
+			map->dyn.level[(long)y * map->width + x]
+				+= sign * contrib(map, l, x, y);
+			map->dyn.relit++;
+			x++;
+		}
+		y++;
+	}
+}
+
+/**
+ * @brief Adds a dynamic light to the map, allocating the tile grid on the
+ * first call.
+ * @param map Pointer to the t_map structure.
+ * @param x World X.
+ * @param y World Y.
+ * @param radius Reach of the light, in tiles.
+ * @return int Id of the light, or -1 if the table is full or malloc fails.
+ */
+int	add_dyn_light(t_map *map, double x, double y, double radius)
+{
+	t_light	*l;
+
+	if (map->dyn.count >= MAX_DYN_LIGHTS)
+		return (ft_error("Too many dynamic lights\n"), -1);
+	if (!map->dyn.level)
+		map->dyn.level = ft_calloc((long)map->width * map->height,
+				sizeof(unsigned short));
+	if (!map->dyn.level)
+		return (ft_error("Malloc failed\n"), -1);
+	l = &map->dyn.lights[map->dyn.count];
+	l->x = x;
+	l->y = y;
+	l->radius = radius;
+	apply_dyn_light(map, l, 1);
+	return (map->dyn.count++);
+}
+
+/**
+ * @brief Moves a dynamic light: only the tiles around its old and new
+ * positions are recomputed.
+ * @param map Pointer to the t_map structure.
+ * @param id Id returned by add_dyn_light().
+ * @param x New world X.
+ * @param y New world Y.
+ */
+void	move_dyn_light(t_map *map, int id, double x, double y)
+{
+	t_light	*l;
+
+	l = &map->dyn.lights[id];
+	if (l->x == x && l->y == y)
+		return ;
+	apply_dyn_light(map, l, -1);
+	l->x = x;
+	l->y = y;
+	apply_dyn_light(map, l, 1);
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dyn_light_bench.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:42:03 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:14:37 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file dyn_light_bench.c
+ * @brief Start-up benchmark of the dynamic light grid, run by
+ * RENDER_STATS builds: DYN_BENCH_LIGHTS lights wander for DYN_BENCH_FRAMES
+ * frames over a DYN_BENCH_SIZE x DYN_BENCH_SIZE map of its own (rooms
+ * with doorways, and pillars), so the figures do not depend on the map
+ * being played, and the update cost is printed.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief xorshift32 step; returns a value in [0, 1).
+ */
+static double	next_random(unsigned int *seed)
+{
+	*seed ^= *seed << 13;
+	*seed ^= *seed >> 17;
+	*seed ^= *seed << 5;
+	return (*seed / 4294967296.0);
+}
+
+/**
+ * @brief Adds a benchmark light at a random point of a random open tile.
+ * @param map Pointer to the t_map structure.
+ * @param seed Random state.
+ * @return int Id of the light, or -1 on failure.
+ */
+static int	add_random_light(t_map *map, unsigned int *seed)
+{
+	double	x;
+	double	y;
+
+	x = -1;
+	y = -1;
+	while (is_solid(map, (int)x, (int)y))
+	{
+		x = next_random(seed) * map->width;
+		y = next_random(seed) * map->height;
+	}
+	return (add_dyn_light(map, x, y, DYN_BENCH_RADIUS));
+}
+
+/**
+ * @brief Moves light `id` by a random step of up to a quarter of a tile
+ * per axis, staying put when the step would enter a wall.
+ * @param map Pointer to the t_map structure.
+ * @param id Light id.
+ * @param seed Random state.
+ */
+static void	wander(t_map *map, int id, unsigned int *seed)
+{
+	double	x;
+	double	y;
+
+	x = map->dyn.lights[id].x + (next_random(seed) - 0.5) * 0.5;
+	y = map->dyn.lights[id].y + (next_random(seed) - 0.5) * 0.5;
+	if (!is_solid(map, (int)x, (int)y))
+		move_dyn_light(map, id, x, y);
+}
+
+/**
+ * @brief Builds the benchmark map: a closed grid of 32-tile rooms joined
+ * by 4-tile doorways, with a pillar every 8 tiles, and its occupancy grid.
+ * @param map Zeroed t_map structure to fill; freed with `free_map`.
+ * @return bool True on success, false on allocation failure.
+ */
+static bool	build_bench_map(t_map *map)
+{
+	int	x;
+	int	y;
+
+	map->width = DYN_BENCH_SIZE;
+	map->height = DYN_BENCH_SIZE;
+	map->grid = ft_calloc(map->height + 1, sizeof(char *));
+	y = -1;
+	while (map->grid && ++y < map->height)
+	{
+		map->grid[y] = malloc(map->width + 1);
+		if (!map->grid[y])
+			return (ft_error("Malloc failed\n"), false);
+		x = -1;
+		while (++x < map->width)
+			map->grid[y][x] = '0' + ((x % 32 == 0 && y % 32 / 4 != 4)
+					|| (y % 32 == 0 && x % 32 / 4 != 4)
+					|| (x % 8 == 4 && y % 8 == 4) || x == map->width - 1
+					|| y == map->height - 1);
+		map->grid[y][x] = '\0';
+	}
+	if (!map->grid)
+		return (ft_error("Malloc failed\n"), false);
+	return (build_occupancy(map));
+}
+
+/**
+ * @brief Times DYN_BENCH_FRAMES frames of DYN_BENCH_LIGHTS moving lights
+ * of radius DYN_BENCH_RADIUS on the benchmark map and prints the cost per
+ * frame.
+ */
+void	bench_dyn_lights(void)
+{
+	t_map			map;
+	clock_t			start;
+	unsigned int	seed;
+	int				i;
+
+	ft_bzero(&map, sizeof(t_map));
+	seed = 2463534242u;
+	i = 0;
+	if (build_bench_map(&map))
+		while (i < DYN_BENCH_LIGHTS && add_random_light(&map, &seed) >= 0)
+			i++;
+	if (i == DYN_BENCH_LIGHTS)
+	{
+		map.dyn.relit = 0;
+		start = clock();
+		i = 0;
+		while (i < DYN_BENCH_FRAMES * DYN_BENCH_LIGHTS)
+			wander(&map, i++ % DYN_BENCH_LIGHTS, &seed);
+		printf("dynamic lights (%dx%d map, %d lights, radius %d): %.3f ms "
+			"and %ld tiles relit per frame\n", map.width, map.height,
+			DYN_BENCH_LIGHTS, DYN_BENCH_RADIUS, (clock() - start) * 1000.0
+			/ CLOCKS_PER_SEC / DYN_BENCH_FRAMES, map.dyn.relit
+			/ DYN_BENCH_FRAMES);
+	}
+	free_map(&map);
+}
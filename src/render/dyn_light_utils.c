@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dyn_light_utils.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:17:34 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:19:32 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file dyn_light_utils.c
+ * @brief Keeps the dynamic light grid in step with runtime changes of the
+ * map layout (doors).
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Removes (sign -1) or adds back (sign 1) every dynamic light whose
+ * square reaches tile (x, y). Called around a change of the solidity of
+ * that tile: the contribution of those lights goes through it (or stops
+ * on it), so it is taken out under the old layout and put back under the
+ * new one, and the grid keeps holding exactly what the lights add.
+ * @param map Pointer to the t_map structure.
+ * @param x The column index of the tile.
+ * @param y The row index of the tile.
+ * @param sign -1 before the change, 1 after it.
+ */
+void	relight_tile(t_map *map, int x, int y, int sign)
+{
+	t_light	*l;
+	int		i;
+
+	if (!map->dyn.level)
+		return ;
+	i = 0;
+	while (i < map->dyn.count)
+	{
+		l = &map->dyn.lights[i++];
+		if (x >= (int)(l->x - l->radius) && x <= (int)(l->x + l->radius)
+			&& y >= (int)(l->y - l->radius) && y <= (int)(l->y + l->radius))
+			apply_dyn_light(map, l, sign);
+	}
+}
@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   floor.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:05:12 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:26:53 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file floor.c
+ * @brief Floor and ceiling, drawn one horizontal scanline at a time.
+ * Every pixel of a floor row lies at the same distance, so a row is one
+ * division plus a constant texture step across the screen: a linear walk
+ * through memory the compiler can vectorize. The ceiling row mirrored
+ * around the horizon shares the same world positions. Rows are processed
+ * in bands of FLOOR_BAND, independent of each other.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Converts a world coordinate or step to 0.32 fixed point, keeping
+ * only its fractional part (mod 1, so negative values wrap correctly).
+ * @param v Value in tiles.
+ * @return uint32_t Fraction of `v` in units of 2^-32 tile.
+ */
+static uint32_t	to_frac(double v)
+{
+	return ((uint32_t)(int64_t)((v - floor(v)) * 4294967296.0));
+}
+
+/**
+ * @brief Sets up the scanline `p` rows away from the horizon: the world
+ * position seen by the leftmost column, and the advance per column. Column
+ * x looks along dir - plane * offset like its wall ray (see camera_sweep),
+ * so the row starts at dir + plane and steps by -plane.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param p Row offset from the horizon (0 is the row right below it).
+ * @param s Scanline to fill.
+ */
+static void	init_scan(t_cub3d *cub, int p, t_scan *s)
+{
+	t_player	*pl;
+	double		dist;
+	double		step;
+
+	pl = &cub->player;
+	dist = cub->screen_height / 2.0 / (p + 0.5);
+	step = 2.0 * dist / cub->screen_width;
+	s->x = to_frac(pl->x + dist * (pl->dir_x + pl->plane_x));
+	s->y = to_frac(pl->y + dist * (pl->dir_y + pl->plane_y));
+	s->step_x = to_frac(-pl->plane_x * step);
+	s->step_y = to_frac(-pl->plane_y * step);
+}
+
+/**
+ * @brief Draws one textured scanline. The texel is picked from the top 16
+ * bits of the position inside the tile scaled to the texture size, so any
+ * texture size tiles seamlessly.
+ * @param tex Floor or ceiling texture (copied locally, so its fields stay
+ * in registers while the frame is written).
+ * @param dst First pixel of the frame row.
+ * @param s Scanline start and step (by value: walked locally).
+ * @param width Number of pixels in the row.
+ */
+static void	scan_row(t_img *tex, unsigned int *dst, t_scan s, int width)
+{
+	t_img		t;
+	uint32_t	tx;
+	uint32_t	ty;
+	int			i;
+
+	t = *tex;
+	i = 0;
+	while (i < width)
+	{
+		tx = (s.x >> 16) * t.width >> 16;
+		ty = (s.y >> 16) * t.height >> 16;
+		dst[i] = *(unsigned int *)(t.data + ty * t.line_len + tx * 4);
+		s.x += s.step_x;
+		s.y += s.step_y;
+		i++;
+	}
+}
+
+/**
+ * @brief Draws frame row `y` of the floor or of the ceiling: from the sky
+ * or the texture when the map gives one, flat colored otherwise.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param y Frame row.
+ * @param s Scanline of the row.
+ * @param tex TEX_FLOOR or TEX_CEILING.
+ */
+static void	draw_plane_row(t_cub3d *cub, int y, t_scan *s, int tex)
+{
+	unsigned int	*row;
+	int				color;
+	int				i;
+
+	row = (unsigned int *)(cub->frame.data + y * cub->frame.line_len);
+	color = cub->map.floor_color;
+	if (tex == TEX_CEILING)
+		color = cub->map.ceiling_color;
+	if (tex == TEX_CEILING && cub->sky_u)
+		draw_sky_row(cub, row, y);
+	else if (has_texture(cub, tex))
+		scan_row(&cub->textures[tex], row, *s, cub->frame.width);
+	else
+	{
+		i = 0;
+		while (i < cub->frame.width)
+			row[i++] = color;
+	}
+}
+
+/**
+ * @brief Draws the floor rows `from` to `to` (excluded) below the horizon
+ * and the ceiling rows mirroring them above it, as far as each goes on
+ * screen: the horizon moves with the pitch of the view, and the row offset
+ * from it still gives the distance of a row.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param from First row offset from the horizon.
+ * @param to Last row offset (excluded), clamped to the screen.
+ */
+void	draw_floor_band(t_cub3d *cub, int from, int to)
+{
+	t_scan	s;
+	int		half;
+
+	half = cub->screen_height / 2 + cub->player.pitch;
+	to = clamp(to, 0, cub->screen_height - cub->screen_height / 2
+			+ abs(cub->player.pitch));
+	while (from < to)
+	{
+		init_scan(cub, from, &s);
+		if (half + from < cub->screen_height)
+			draw_plane_row(cub, half + from, &s, TEX_FLOOR);
+		if (from < half)
+			draw_plane_row(cub, half - 1 - from, &s, TEX_CEILING);
+		from++;
+	}
+}
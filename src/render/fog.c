@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fog.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:41:18 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/18 00:59:17 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file fog.c
+ * @brief Distance fog for a finite VIEW_DISTANCE.
+ * Walls fade towards FOG_COLOR from FOG_START * VIEW_DISTANCE on and are
+ * pure fog at VIEW_DISTANCE, where rays stop. Rays that stop without a hit
+ * are drawn as a fog wall at that distance, so nothing pops at the limit.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Builds the fog weight table, indexed by projected wall height
+ * (the distance is screen_height / line_h). Indexing by height keeps the
+ * weight consistent with everything else keyed on line_h, such as the
+ * column cache. Does nothing when VIEW_DISTANCE is 0.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @return bool True on success, false on allocation failure.
+ */
+bool	init_fog(t_cub3d *cub)
+{
+	double	d;
+	double	start;
+	int		h;
+
+	if (VIEW_DISTANCE <= 0)
+		return (true);
+	cub->fog_lut = malloc((cub->screen_height + 1) * sizeof(unsigned short));
+	if (!cub->fog_lut)
+		return (ft_error("Malloc failed\n"), false);
+	start = FOG_START * VIEW_DISTANCE;
+	cub->fog_lut[0] = 256;
+	h = 1;
+	while (h <= cub->screen_height)
+	{
+		d = (double)cub->screen_height / h;
+		d = (d - start) / (VIEW_DISTANCE - start);
+		cub->fog_lut[h] = (unsigned short)(256 * fmin(fmax(d, 0), 1));
+		h++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Draws a column whose ray stopped at the view distance: a wall of
+ * the height a wall at VIEW_DISTANCE would have, fully fogged.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param r Ray of the column (hit == 0).
+ * @param x Screen column.
+ */
+void	draw_fog_column(t_cub3d *cub, t_ray *r, int x)
+{
+	unsigned int	*px;
+	int				y;
+
+	r->perp = VIEW_DISTANCE;
+	r->line_h = (int)(cub->screen_height / (double)VIEW_DISTANCE);
+	calc_line_params(cub, r);
+	px = (unsigned int *)(cub->frame.data + r->start * cub->frame.line_len)
+		+ x;
+	y = r->start;
+	while (y <= r->end)
+	{
+		*px = FOG_COLOR;
+		px += cub->frame.line_len / 4;
+		y++;
+	}
+}
+
+/**
+ * @brief Blends a colour towards FOG_COLOR; red and blue are weighted
+ * together in one multiply, green in another.
+ * @param c Colour (0xRRGGBB).
+ * @param w Fog weight, 0 (none) to 256 (fog colour only).
+ * @return unsigned int The blended colour.
+ */
+unsigned int	fog_blend(unsigned int c, int w)
+{
+	unsigned int	rb;
+	unsigned int	g;
+
+	rb = ((c & 0xFF00FF) * (256 - w) + (FOG_COLOR & 0xFF00FF) * w) >> 8;
+	g = ((c & 0x00FF00) * (256 - w) + (FOG_COLOR & 0x00FF00) * w) >> 8;
+	return ((rb & 0xFF00FF) | (g & 0x00FF00));
+}
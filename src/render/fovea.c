@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fovea.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:48:03 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/18 19:48:03 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file fovea.c
+ * @brief Foveated column density (FOVEATED=1).
+ * Columns within FOVEA_RADIUS of the centre (as a fraction of the half
+ * screen width) get one ray each. Farther out, columns are grouped by 2,
+ * then by 4 up to FOVEA_MAX_STRIDE: one ray is cast through the centre of
+ * each group and the other columns of the group replicate it.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Number of columns sharing one ray around column x.
+ * The density is constant over blocks of FOVEA_MAX_STRIDE columns, so a
+ * group never straddles two density bands.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param x Screen column.
+ * @return int A power of two between 1 and FOVEA_MAX_STRIDE.
+ */
+int	column_stride(t_cub3d *cub, int x)
+{
+	double	d;
+	int		block;
+	int		stride;
+
+	if (!FOVEATED)
+		return (1);
+	block = x / FOVEA_MAX_STRIDE * FOVEA_MAX_STRIDE + FOVEA_MAX_STRIDE / 2;
+	d = fabs(2.0 * block / cub->screen_width - 1.0);
+	if (d <= FOVEA_RADIUS)
+		return (1);
+	d = (d - FOVEA_RADIUS) / (1.0 - FOVEA_RADIUS);
+	stride = 2;
+	while (stride < FOVEA_MAX_STRIDE
+		&& d > (double)stride / FOVEA_MAX_STRIDE)
+		stride *= 2;
+	return (stride);
+}
+
+/**
+ * @brief First column of the group column x belongs to; the ray of the
+ * group is stored there.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param x Screen column.
+ * @return int Column holding the group's ray.
+ */
+int	column_rep(t_cub3d *cub, int x)
+{
+	return (x - x % column_stride(cub, x));
+}
+
+/**
+ * @brief Screen position the ray of column x goes through: the column
+ * itself at full density, the centre of its group otherwise.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param x Screen column (first of its group).
+ * @return double Horizontal screen coordinate of the sample.
+ */
+double	column_sample(t_cub3d *cub, int x)
+{
+	return (x + (column_stride(cub, x) - 1) / 2.0);
+}
+
+/**
+ * @brief Draws a replicated column by copying the column on its left,
+ * which holds the same ray and has just been drawn.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param x Screen column (not the first of its group).
+ */
+void	replicate_column(t_cub3d *cub, int x)
+{
+	unsigned int	*px;
+	t_ray			*r;
+	int				y;
+
+	r = &cub->rays[x];
+	*r = cub->rays[x - 1];
+	px = (unsigned int *)(cub->frame.data + r->start * cub->frame.line_len)
+		+ x;
+	y = r->start;
+	while (y <= r->end)
+	{
+		px[0] = px[-1];
+		px += cub->frame.line_len / 4;
+		y++;
+	}
+}
@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   grates.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:33:34 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 01:48:54 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file grates.c
+ * @brief See-through walls, on the raycaster's side.
+ * When a ray steps into a grate tile, the face it crossed is stored as a
+ * layer of its column and the walk goes on to the wall behind. The cost of
+ * a column stays bounded: a ray stops on a grate once MAX_LAYERS layers
+ * are stored, and as soon as it meets a texture column with no transparent
+ * texel, since nothing behind it could show. Those columns are found once,
+ * when the renderer starts.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Flags the columns of the grate texture that have no transparent
+ * texel (the XPM "None" colour, loaded with the alpha byte set).
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+static void	find_opaque_columns(t_cub3d *cub)
+{
+	t_img	*tex;
+	int		x;
+	int		y;
+
+	tex = &cub->textures[TEX_GRATE];
+	x = 0;
+	while (x < tex->width)
+	{
+		cub->grate_opaque[x] = true;
+		y = 0;
+		while (y < tex->height && cub->grate_opaque[x])
+		{
+			if (*(unsigned int *)(tex->data + y * tex->line_len
+				+ x * (tex->bpp / 8)) & 0xFF000000)
+				cub->grate_opaque[x] = false;
+			y++;
+		}
+		x++;
+	}
+}
+
+/**
+ * @brief Allocates the layer slots of every column, on maps with grates or
+ * wall heights, and flags the opaque columns of the grate texture.
+ * Must run after the textures are loaded.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @return bool True on success, false on allocation failure.
+ */
+bool	init_layers(t_cub3d *cub)
+{
+	if (!cub->map.grates && !cub->map.heights)
+		return (true);
+	cub->layers = malloc(cub->screen_width * MAX_LAYERS * sizeof(t_layer));
+	if (!cub->layers)
+		return (ft_error("Malloc failed\n"), false);
+	if (!cub->map.grates)
+		return (true);
+	cub->grate_opaque = malloc(cub->textures[TEX_GRATE].width * sizeof(bool));
+	if (!cub->grate_opaque)
+		return (ft_error("Malloc failed\n"), false);
+	find_opaque_columns(cub);
+	return (true);
+}
+
+/**
+ * @brief Texture column seen at `wall_x` on the face of a layer, mirrored
+ * like the wall faces are.
+ * @param tex Texture of the face (or one of its shaded copies).
+ * @param r Ray crossing the face.
+ * @param side Face crossed (0 vertical, 1 horizontal).
+ * @param wall_x Where the ray crosses the face, 0 to 1 along it.
+ * @return int The texture column.
+ */
+int	layer_tex_x(t_img *tex, t_ray *r, int side, double wall_x)
+{
+	int	tex_x;
+
+	tex_x = (int)(wall_x * tex->width);
+	if ((side == 0 && r->dir_x > 0) || (side == 1 && r->dir_y < 0))
+		tex_x = tex->width - tex_x - 1;
+	return (clamp(tex_x, 0, tex->width - 1));
+}
+
+/**
+ * @brief Fills the next free layer slot of a ray with the face it just
+ * crossed, without counting it yet.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param r Ray, just stepped into the tile; it must have a free slot.
+ * @return t_layer* The slot, its height set to the wall height of the tile.
+ */
+t_layer	*push_layer(t_cub3d *cub, t_ray *r)
+{
+	t_layer	*l;
+
+	l = &r->layer[r->layers];
+	l->map_x = r->map_x;
+	l->map_y = r->map_y;
+	l->side = r->side;
+	l->height = wall_height(&cub->map, r->map_x, r->map_y);
+	l->perp = r->side_y - r->delta_y;
+	l->wall_x = cub->player.x + l->perp * r->dir_x;
+	if (r->side == 0)
+	{
+		l->perp = r->side_x - r->delta_x;
+		l->wall_x = cub->player.y + l->perp * r->dir_y;
+	}
+	l->wall_x -= floor(l->wall_x);
+	return (l);
+}
+
+/**
+ * @brief Called by the DDA when the ray steps into a solid tile: tells
+ * whether the walk ends there. It always does on walls. On a grate, the
+ * face the ray crossed is stored as a new layer and the walk goes on,
+ * unless the layers of the column are full or the texture column there is
+ * fully opaque: the grate is then the hit, drawn like a wall.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param r Ray, just stepped into the tile.
+ * @return bool True if the ray stops in this tile.
+ */
+bool	grate_blocks(t_cub3d *cub, t_ray *r)
+{
+	t_layer	*l;
+
+	if (!is_grate(&cub->map, r->map_x, r->map_y))
+		return (true);
+	r->transient = true;
+	if (r->layers == MAX_LAYERS)
+		return (cub->stats.capped++, true);
+	l = push_layer(cub, r);
+	if (cub->grate_opaque[layer_tex_x(&cub->textures[TEX_GRATE], r,
+				r->side, l->wall_x)])
+		return (cub->stats.opaque++, true);
+	r->layers++;
+	cub->stats.layers++;
+	return (false);
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heights.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:44:07 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 01:53:26 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file heights.c
+ * @brief Walls of other heights than the standard one, on the raycaster's
+ * side (see parse_heights.c for the map section).
+ * A wall no longer hides everything behind it: something taller may still
+ * show above it. So a ray goes on past a wall as long as the highest row
+ * any wall behind it could reach, knowing the tallest wall of the map, is
+ * above the rows covered so far; the walls it goes past are stored as
+ * layers of its column, like grates, and drawn over the wall it stops on.
+ * On maps of standard walls only, the first wall always stops the ray.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Screen row of the top of a wall face, below the horizon by half
+ * a tile, the eye height.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param height Height of the wall in tiles.
+ * @param perp Perpendicular distance to the face.
+ * @return double The row, negative above the screen.
+ */
+static double	face_top(t_cub3d *cub, double height, double perp)
+{
+	return (cub->screen_height / 2 + cub->player.pitch
+		- (height - 0.5) * cub->screen_height / perp);
+}
+
+/**
+ * @brief Called by the DDA when the ray steps into a solid tile, once doors
+ * and grates had their say: tells whether the walk ends there. It goes on
+ * if a wall behind could still show above the rows the walls met so far
+ * cover; this one is then stored as a layer, unless those walls hide it.
+ * Door panels, the border of the map and full layer slots stop the ray.
+ * Whether it stops depends on the pitch of the view, so the hit is never
+ * cached.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param r Ray, just stepped into the tile.
+ * @return bool True if the ray stops in this tile.
+ */
+bool	height_blocks(t_cub3d *cub, t_ray *r)
+{
+	t_layer	*l;
+	double	top;
+
+	if (r->door >= 0 || r->map_x <= 0 || r->map_y <= 0
+		|| r->map_x >= cub->map.width - 1 || r->map_y >= cub->map.height - 1)
+		return (true);
+	r->transient = true;
+	if (r->layers == MAX_LAYERS)
+		return (cub->stats.capped++, true);
+	l = push_layer(cub, r);
+	top = face_top(cub, l->height, l->perp);
+	if (fmin(top, r->clip) <= fmax(0, face_top(cub,
+				cub->map.max_height * 0.5, l->perp)))
+		return (true);
+	if (top < r->clip)
+	{
+		r->clip = top;
+		r->layers++;
+		cub->stats.walls++;
+	}
+	return (false);
+}
@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   interlace.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:02:14 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:13:04 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file interlace.c
+ * @brief Interlaced rendering (INTERLACED=1): rays are cast for the even
+ * columns on one frame and for the odd ones on the next, the other half is
+ * reconstructed (see reproject_column). Fast turns, large moves and map
+ * changes fall back to casting the whole frame, and so do maps with grates
+ * or wall heights, whose layers cannot be reconstructed.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Decides how the current frame is cast and flips the column parity.
+ * Called once at the start of every frame, before any column is cast; the
+ * reconstruction error of the previous frame is folded into its worst.
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+void	interlace_sync(t_cub3d *cub)
+{
+	t_interlace	*il;
+	double		angle;
+	double		turn;
+	double		step;
+
+	il = &cub->interlace;
+	angle = atan2(cub->player.dir_y, cub->player.dir_x);
+	turn = fabs(remainder(angle - il->angle, 2.0 * M_PI));
+	step = hypot(cub->player.x - il->pos_x, cub->player.y - il->pos_y);
+	il->full = !INTERLACED || !il->primed || turn > INTERLACE_MAX_TURN
+		|| step > INTERLACE_MAX_STEP || il->map_version != cub->map.version
+		|| cub->map.grates || cub->map.heights;
+	il->parity ^= 1;
+	il->pos_x = cub->player.x;
+	il->pos_y = cub->player.y;
+	il->angle = angle;
+	il->map_version = cub->map.version;
+	il->primed = true;
+	if (cub->stats.frame_diff > cub->stats.worst_diff)
+		cub->stats.worst_diff = cub->stats.frame_diff;
+	cub->stats.frame_diff = 0;
+}
+
+/**
+ * @brief Tells in which pass of raycast a column is handled.
+ * The parity is that of the column group, so foveated groups alternate
+ * like single columns do.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param x Screen column.
+ * @return int 0 if a ray is cast for it, 1 if it is reconstructed after
+ * all the cast columns are known, 2 if it replicates the ray of its
+ * foveated group.
+ */
+int	column_pass(t_cub3d *cub, int x)
+{
+	int	stride;
+
+	stride = column_stride(cub, x);
+	if (x % stride)
+		return (2);
+	if (cub->interlace.full || (x / stride & 1) == cub->interlace.parity)
+		return (0);
+	return (1);
+}
+
+/**
+ * @brief Perpendicular distance to the face a traced ray hit.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param r Traced ray.
+ * @return double The distance, or a huge one if the ray hit nothing.
+ */
+static double	face_perp(t_cub3d *cub, t_ray *r)
+{
+	double	face;
+
+	if (!r->hit)
+		return (1e30);
+	face = (1 - r->step_x) / 2;
+	if (r->side == 1)
+		face = (1 - r->step_y) / 2;
+	if (r->door >= 0)
+		face = 0.5;
+	if (r->side == 0)
+		return ((r->map_x - cub->player.x + face) / r->dir_x);
+	return ((r->map_y - cub->player.y + face) / r->dir_y);
+}
+
+/**
+ * @brief RENDER_STATS check of a reconstructed column: traces the real ray
+ * and, if it hits another face, counts a mismatch and the pixels that may
+ * differ from a full cast. Both walls are centred on the horizon and the
+ * floor and ceiling around them are the same, so those are the rows of the
+ * taller of the two wall lines, over every column of the group.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param r Reconstructed ray.
+ * @param x Screen column.
+ */
+static void	check_reconstruction(t_cub3d *cub, t_ray *r, int x)
+{
+	t_ray	check;
+	long	pixels;
+
+	init_ray_vars(cub, &check, x);
+	trace_ray(cub, &check);
+	if (check.map_x == r->map_x && check.map_y == r->map_y
+		&& check.side == r->side)
+		return ;
+	cub->stats.mismatches++;
+	check.line_h = (int)fmin(cub->screen_height
+			/ fmin(face_perp(cub, &check), r->perp), cub->screen_height * 10);
+	calc_line_params(cub, &check);
+	pixels = (long)(check.end - check.start + 1) * column_stride(cub, x);
+	cub->stats.diff_pixels += pixels;
+	cub->stats.frame_diff += pixels;
+}
+
+/**
+ * @brief Fills the ray of one column for the current frame.
+ * Columns of the second pass are first reconstructed from the previous
+ * frame's hit in the same slot and from their neighbours; a ray is traced
+ * only when none of those faces is on the column's ray. Columns of the
+ * third pass copy the ray of their foveated group.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param x Screen column.
+ */
+void	cast_column(t_cub3d *cub, int x)
+{
+	t_ray	*r;
+	t_ray	prev;
+
+	r = &cub->rays[x];
+	if (column_pass(cub, x) == 2)
+	{
+		*r = cub->rays[x - 1];
+		return ;
+	}
+	prev = *r;
+	init_ray_vars(cub, r, x);
+	if (column_pass(cub, x) == 1 && reproject_column(cub, r, &prev, x))
+	{
+		cub->stats.reconstructed++;
+		if (RENDER_STATS)
+			check_reconstruction(cub, r, x);
+		return ;
+	}
+	trace_ray(cub, r);
+	cub->stats.rays++;
+}
@@ -0,0 +1,157 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   layer_draw.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:33:34 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:20:43 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file layer_draw.c
+ * @brief Draws the faces of other heights than the standard one, and
+ * composites the layers of each column, far to near, over what lies behind
+ * them; only opaque texels are written.
+ * Layers are drawn late, after the walls: a sprite standing between two
+ * layers of a column draws the farther ones first (see draw_sprite), and
+ * whatever is left once all sprites are drawn goes on top.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Scales the texture column of a projected face onto screen
+ * column x, leaving the frame untouched under transparent texels.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param r Projected face (tex, tex_x, line_h, mid, start and end set);
+ * its `start` is used as the row counter.
+ * @param x Screen column.
+ * @param fog Fog weight at the face's depth (0 without fog).
+ */
+static void	scale_face(t_cub3d *cub, t_ray *r, int x, int fog)
+{
+	unsigned int	*dst;
+	char			*src;
+	unsigned int	c;
+	int				pos;
+	int				step;
+
+	step = ((long)r->tex->height << 16) / r->line_h;
+	pos = ((long)(2 * (r->start - r->mid) + r->line_h)
+			* ((long)r->tex->height << 16)) / (2 * r->line_h);
+	src = r->tex->data + r->tex_x * (r->tex->bpp / 8);
+	dst = (unsigned int *)(cub->frame.data + r->start * cub->frame.line_len)
+		+ x;
+	while (r->start++ <= r->end)
+	{
+		if ((pos >> 16) >= r->tex->height)
+			pos = (r->tex->height - 1) << 16;
+		c = *(unsigned int *)(src + (pos >> 16) * r->tex->line_len);
+		if (!(c & 0xFF000000) && fog)
+			*dst = fog_blend(c, fog);
+		else if (!(c & 0xFF000000))
+			*dst = c;
+		dst += cub->frame.line_len / 4;
+		pos += step;
+	}
+}
+
+/**
+ * @brief Draws a projected face of any height standing on the floor: the
+ * texture is repeated once per tile of height, from the bottom up, and cut
+ * at the top of the face (a half wall shows the lower half).
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param r Projected face (tex, tex_x, line_h and mid set); start and end
+ * are overwritten.
+ * @param x Screen column.
+ * @param height Height of the face in tiles.
+ */
+void	draw_face(t_cub3d *cub, t_ray *r, int x, double height)
+{
+	int	mid;
+	int	top;
+	int	fog;
+	int	k;
+
+	fog = 0;
+	if (cub->fog_lut)
+		fog = cub->fog_lut[clamp(r->line_h, 0, cub->screen_height)];
+	mid = r->mid;
+	top = clamp(mid - r->line_h / 2 - (int)((height - 1) * r->line_h), 0,
+			cub->screen_height);
+	k = 0;
+	while (k < height)
+	{
+		r->mid = mid - k * r->line_h;
+		r->start = clamp(r->mid - r->line_h / 2, top, cub->screen_height);
+		r->end = clamp(r->mid + r->line_h / 2, -1, cub->screen_height - 1);
+		if (r->start <= r->end)
+			scale_face(cub, r, x, fog);
+		k++;
+	}
+	r->mid = mid;
+}
+
+/**
+ * @brief Projects one layer of a column like a wall face and draws it.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param col Ray of the column.
+ * @param l Layer to draw.
+ * @param x Screen column.
+ */
+static void	draw_layer(t_cub3d *cub, t_ray *col, t_layer *l, int x)
+{
+	t_ray	r;
+
+	r = *col;
+	r.map_x = l->map_x;
+	r.map_y = l->map_y;
+	r.side = l->side;
+	r.perp = l->perp;
+	r.door = -1;
+	r.line_h = (int)fmin(cub->screen_height / l->perp,
+			cub->screen_height * 10);
+	calc_line_params(cub, &r);
+	r.tex = shade_texture(cub, select_wall_texture(cub, &r), &r,
+			face_light(&cub->map, &r, l->wall_x));
+	r.tex_x = layer_tex_x(r.tex, &r, l->side, l->wall_x);
+	draw_face(cub, &r, x, l->height);
+}
+
+/**
+ * @brief Draws the layers of a column that are farther than `depth` and
+ * not drawn yet, far to near.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param x Screen column.
+ * @param depth Distance to keep in front of the layers (0 for all).
+ */
+void	draw_layers(t_cub3d *cub, int x, double depth)
+{
+	t_ray	*r;
+
+	r = &cub->rays[x];
+	while (r->layers > 0 && r->layer[r->layers - 1].perp > depth)
+	{
+		r->layers--;
+		draw_layer(cub, r, &r->layer[r->layers], x);
+	}
+}
+
+/**
+ * @brief Draws every layer still pending, once the sprites are drawn.
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+void	flush_layers(t_cub3d *cub)
+{
+	int	x;
+
+	x = 0;
+	while (x < cub->screen_width)
+	{
+		if (cub->rays[x].layers)
+			draw_layers(cub, x, 0);
+		x++;
+	}
+}
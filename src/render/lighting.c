@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lighting.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:48:19 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:31:25 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file lighting.c
+ * @brief Render-time lookup of the baked lightmap and the dynamic light
+ * grid.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Baked samples of a face (see t_map::light_of): the slot of a face
+ * is the tile's first slot plus the faces with samples before it.
+ * @param map Pointer to the t_map structure, with a lightmap.
+ * @param x Tile X (inside the grid).
+ * @param y Tile Y (inside the grid).
+ * @param f Face index (0 east, 1 west, 2 south, 3 north).
+ * @return unsigned char* Its LIGHTMAP_RES samples, or NULL if the face
+ * does not border open space and has none.
+ */
+unsigned char	*face_samples(t_map *map, int x, int y, int f)
+{
+	int		packed;
+	long	slot;
+	int		i;
+
+	packed = map->light_of[(long)y * map->width + x];
+	if (!((packed >> f) & 1))
+		return (NULL);
+	slot = packed >> 4;
+	i = 0;
+	while (i < f)
+		slot += (packed >> i++) & 1;
+	return (map->light + slot * LIGHTMAP_RES);
+}
+
+/**
+ * @brief Baked brightness of a point of the face the ray hit, interpolated
+ * between the two nearest samples.
+ * @param map Pointer to the t_map structure.
+ * @param r Ray of the column (hit tile, side and step set).
+ * @param wall_x Position across the face, in [0, 1), unmirrored.
+ * @return int Brightness in 1/256 units, plain ambient light on a face
+ * without samples (seen through a door or a grate).
+ */
+static int	baked_light(t_map *map, t_ray *r, double wall_x)
+{
+	unsigned char	*s;
+	double			pos;
+	int				f;
+	int				i;
+
+	f = r->side * 2 + ((r->side == 0) * r->step_x + r->side * r->step_y > 0);
+	s = face_samples(map, r->map_x, r->map_y, f);
+	if (!s)
+		return ((int)(LIGHT_AMBIENT * 256));
+	pos = wall_x * LIGHTMAP_RES - 0.5;
+	i = clamp((int)floor(pos), 0, LIGHTMAP_RES - 2);
+	pos = fmin(fmax(pos - i, 0), 1);
+	return ((int)((s[i] + (s[i + 1] - s[i]) * pos) * 256 / 255));
+}
+
+/**
+ * @brief Brightness of a wall column: the baked lightmap (or plain ambient
+ * light without one) plus the dynamic lights of the open tile in front of
+ * the face.
+ * @param map Pointer to the t_map structure.
+ * @param r Ray of the column (hit tile, side and step set).
+ * @param wall_x Position across the face, in [0, 1), unmirrored.
+ * @return int Brightness in 1/256 units, 256 when the map has no lights.
+ */
+int	face_light(t_map *map, t_ray *r, double wall_x)
+{
+	int	light;
+
+	if (!map->light && !map->dyn.level)
+		return (256);
+	if (map->light)
+		light = baked_light(map, r, wall_x);
+	else
+		light = (int)(LIGHT_AMBIENT * 256);
+	if (map->dyn.level)
+		light += map->dyn.level[(long)(r->map_y - r->side * r->step_y)
+			* map->width + r->map_x - (1 - r->side) * r->step_x];
+	if (light > 256)
+		return (256);
+	return (light);
+}
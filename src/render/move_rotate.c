@@ -6,7 +6,7 @@
 /*   By: vjan-nie <vjan-nie@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/18 17:01:22 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/12/16 13:01:37 by vjan-nie         ###   ########.fr       */
+/*   Updated: 2026/10/19 01:53:26 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -57,3 +57,20 @@ void	rotate_right(t_cub3d *cub)
 	rot = -p->rot_speed;
 	rotate_dir_plane(p, rot);
 }
+
+/**
+ * @brief Moves the horizon by PITCH_SPEED of the screen height per frame,
+ * down to look up and up to look down, within PITCH_MAX of the screen
+ * height from the middle.
+ */
+void	look_up_down(t_cub3d *cub, bool up)
+{
+	int	step;
+	int	limit;
+
+	step = (int)(cub->screen_height * PITCH_SPEED);
+	if (!up)
+		step = -step;
+	limit = (int)(cub->screen_height * PITCH_MAX);
+	cub->player.pitch = clamp(cub->player.pitch + step, -limit, limit);
+}
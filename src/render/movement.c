@@ -6,29 +6,18 @@
 /*   By: sergio-jimenez <sergio-jimenez@student.    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/23 16:47:14 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/12/10 14:09:25 by sergio-jime      ###   ########.fr       */
+/*   Updated: 2026/10/18 23:25:07 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "cub3d.h"
 
-/**
- * @brief Checks if the attempted movement result is
- * valid.
- */
-static bool	is_walkable(char c)
-{
-	if (c == '0')
-		return (true);
-	if (c == 'N' || c == 'S' || c == 'E' || c == 'W')
-		return (true);
-	return (false);
-}
-
 /**
  * @brief Checks for movement attempts accumulated by keyboard input,
  * calculates result and, if it's a valid movement, updates the
  * player's position.
+ * @note The destination tiles are tested against the occupancy grid,
+ * which also rejects anything outside the map.
  */
 void	check_and_move(t_cub3d *cub, double mx, double my)
 {
@@ -49,8 +38,8 @@ void	check_and_move(t_cub3d *cub, double mx, double my)
 		margin_y = -WALL_MARGIN;
 	next_x = (int)(p->x + mx + margin_x);
 	next_y = (int)(p->y + my + margin_y);
-	if (is_walkable(cub->map.grid[(int)p->y][next_x]))
+	if (!is_solid(&cub->map, next_x, (int)p->y))
 		p->x += mx;
-	if (is_walkable(cub->map.grid[next_y][(int)p->x]))
+	if (!is_solid(&cub->map, (int)p->x, next_y))
 		p->y += my;
 }
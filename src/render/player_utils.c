@@ -6,7 +6,7 @@
 /*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/18 17:04:04 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/12/03 18:22:59 by vjan-nie         ###   ########.fr       */
+/*   Updated: 2026/10/19 01:53:26 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -18,7 +18,7 @@
  * If any of the key codes realted to movement 
  * have been pressed (with the value 'true'),
  * we initiate the attempt to update the position 
- * and direction.
+ * and direction. The doors are animated afterwards.
  */
 void	update_player(t_cub3d *cub)
 {
@@ -34,6 +34,9 @@ void	update_player(t_cub3d *cub)
 		rotate_left(cub);
 	if (cub->key_code.right)
 		rotate_right(cub);
+	if (cub->key_code.up != cub->key_code.down)
+		look_up_down(cub, cub->key_code.up);
+	update_doors(cub);
 }
 
 /**
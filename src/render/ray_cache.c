@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ray_cache.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:12:40 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:11:33 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file ray_cache.c
+ * @brief Angular ray-hit cache for frames where the player only rotates.
+ * From a fixed position, the wall hit by a ray depends on its direction only.
+ * Each cast ray is stored in a slot chosen by its quantized angle, together
+ * with its exact angle and the face it hit. A new ray reuses a hit when the
+ * cached rays closest to it on both sides hit the same face of the same tile:
+ * a tile face is convex and any occluder in between would be a whole tile,
+ * at least one tile wide seen from any direction. That only rules it out
+ * while the two rays are less than a tile apart where they reach the face,
+ * so a hit is reused only when the angle between them times the distance
+ * to the far corner of the tile is under 1 (the gap grows with distance,
+ * and on large open maps far hits are traced again). Distances are still
+ * computed from the ray's own direction (`calc_line_params`), so the result
+ * is exact.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Maps a ray angle to its cache slot.
+ * @param angle Ray direction in radians (-PI..PI).
+ * @return int Slot index in [0, RAY_CACHE_SIZE).
+ */
+static int	slot_of(double angle)
+{
+	int	slot;
+
+	slot = (int)((angle + M_PI) * (RAY_CACHE_SIZE / (2.0 * M_PI)));
+	return (clamp(slot, 0, RAY_CACHE_SIZE - 1));
+}
+
+/**
+ * @brief Keeps `e` as the lower and/or upper bracket of `angle` if it is
+ * closer than the current ones.
+ * @param e Candidate entry (already known to be valid).
+ * @param angle Angle of the ray being looked up.
+ * @param lo Closest entry found so far at or below `angle`.
+ * @param hi Closest entry found so far at or above `angle`.
+ */
+static void	bracket(t_hit_entry *e, double angle, t_hit_entry **lo,
+	t_hit_entry **hi)
+{
+	if (e->angle <= angle && (!*lo || e->angle > (*lo)->angle))
+		*lo = e;
+	if (e->angle >= angle && (!*hi || e->angle < (*hi)->angle))
+		*hi = e;
+}
+
+/**
+ * @brief Tells whether two bracketing entries can stand for every ray in
+ * between: same face of the same tile, and less than a tile apart up to
+ * the far corner of that tile (see the file comment).
+ * @param c Pointer to the ray cache (for the player position).
+ * @param lo Entry at or below the ray angle.
+ * @param hi Entry at or above the ray angle.
+ * @return bool True if the hit can be reused.
+ */
+static bool	reusable(t_ray_cache *c, t_hit_entry *lo, t_hit_entry *hi)
+{
+	double	far;
+
+	if (lo->map_x != hi->map_x || lo->map_y != hi->map_y
+		|| lo->side != hi->side)
+		return (false);
+	far = hypot(fabs(lo->map_x + 0.5 - c->pos_x) + 1,
+			fabs(lo->map_y + 0.5 - c->pos_y) + 1);
+	return (far * (hi->angle - lo->angle) < 1);
+}
+
+/**
+ * @brief Looks for a cached hit for the ray's direction.
+ * Scans the ray's slot and its two neighbours for the closest valid entries
+ * at or below (`lo`) and at or above (`hi`) the ray angle. If both exist,
+ * hit the same face and are close enough at that distance, the hit tile and
+ * side are copied into the ray.
+ * @param c Pointer to the ray cache.
+ * @param r Pointer to the ray, already initialized by `init_ray_vars`.
+ * @return bool True on a cache hit (the DDA can be skipped).
+ */
+bool	ray_cache_fetch(t_ray_cache *c, t_ray *r)
+{
+	t_hit_entry	*lo;
+	t_hit_entry	*hi;
+	int			slot;
+	int			i;
+
+	c->angle = atan2(r->dir_y, r->dir_x);
+	slot = slot_of(c->angle);
+	lo = NULL;
+	hi = NULL;
+	i = slot - 1;
+	while (i <= slot + 1)
+	{
+		if (i >= 0 && i < RAY_CACHE_SIZE && c->entries[i].stamp == c->stamp)
+			bracket(&c->entries[i], c->angle, &lo, &hi);
+		i++;
+	}
+	if (!lo || !hi || !reusable(c, lo, hi))
+		return (false);
+	r->map_x = lo->map_x;
+	r->map_y = lo->map_y;
+	r->side = lo->side;
+	r->hit = 1;
+	return (true);
+}
+
+/**
+ * @brief Stores the hit of a ray that was just traced by the DDA.
+ * Uses the angle computed by the preceding `ray_cache_fetch` call. Rays
+ * stopped by the view distance hit nothing and are not stored.
+ * @param c Pointer to the ray cache.
+ * @param r Pointer to the ray after `perform_dda`.
+ */
+void	ray_cache_store(t_ray_cache *c, t_ray *r)
+{
+	t_hit_entry	*e;
+
+	if (!r->hit || r->transient)
+		return ;
+	e = &c->entries[slot_of(c->angle)];
+	e->angle = c->angle;
+	e->map_x = r->map_x;
+	e->map_y = r->map_y;
+	e->side = r->side;
+	e->stamp = c->stamp;
+}
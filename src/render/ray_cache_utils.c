@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ray_cache_utils.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:26:03 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/18 13:26:03 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file ray_cache_utils.c
+ * @brief Setup and per-frame invalidation of the angular ray-hit cache.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Allocates the cache slots.
+ * Slots start with stamp 0 and the cache with stamp 1, so nothing is valid
+ * until the first ray is stored.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @return bool True on success, false on allocation failure.
+ */
+bool	init_ray_cache(t_cub3d *cub)
+{
+	cub->ray_cache.entries = ft_calloc(RAY_CACHE_SIZE, sizeof(t_hit_entry));
+	if (!cub->ray_cache.entries)
+		return (ft_error("Malloc failed\n"), false);
+	cub->ray_cache.stamp = 1;
+	cub->ray_cache.pos_x = cub->player.x;
+	cub->ray_cache.pos_y = cub->player.y;
+	cub->ray_cache.map_version = cub->map.version;
+	return (true);
+}
+
+/**
+ * @brief Invalidates the cache when the player moved or the map changed
+ * since the entries were computed. Called once at the start of every frame.
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+void	ray_cache_sync(t_cub3d *cub)
+{
+	t_ray_cache	*c;
+
+	c = &cub->ray_cache;
+	if (c->pos_x == cub->player.x && c->pos_y == cub->player.y
+		&& c->map_version == cub->map.version)
+		return ;
+	c->stamp++;
+	c->pos_x = cub->player.x;
+	c->pos_y = cub->player.y;
+	c->map_version = cub->map.version;
+}
@@ -6,7 +6,7 @@
 /*   By: vjan-nie <vjan-nie@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/23 16:41:44 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/12/16 13:00:17 by vjan-nie         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:27:39 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,62 +15,60 @@
 /**
 * @brief Initiates the ray's variables for each column,
 * which we will use to calculate and perform DDA.
-* @param ray_offset It's the x normalized coordinate inside the camera plane.
-* Defines an offset amount between the limits of the FOV 
-* (range 1 to -1, being -1 full left, 0 center, and 1 full right).
-* To calculate the current ray's direction, we start from the player's
-* vision direction (center), and strafe it through the camera plane 
-* (p->dir_x + p->plane_x) and (p->dir_y + p->plane_y).
-* We then multiply the result with the offset, to rotate towards 
-* the proper direction.
+* The ray direction is the player's vision direction (center) strafed
+* through the camera plane by the column's offset (range 1 to -1, being -1
+* full left, 0 center, and 1 full right). Directions and deltas of all
+* columns are prepared at the start of the frame (see camera_sweep); with
+* foveated rendering, a ray stands for a group of columns and goes through
+* the centre of the group (see column_sample). On maps with grates or wall
+* heights, the ray gets the layer slots of its column.
 * @note There are security conditions to protect the rays from
 * reaching outside the grid.
 */
-static void	init_ray_vars(t_cub3d *cub, t_ray *r, int x)
+void	init_ray_vars(t_cub3d *cub, t_ray *r, int x)
 {
 	t_player	*p;
-	double		ray_offset;
 
 	p = &cub->player;
-	ray_offset = 2.0 * x / (double)cub->screen_width - 1.0;
-	r->dir_x = p->dir_x - p->plane_x * ray_offset;
-	r->dir_y = p->dir_y - p->plane_y * ray_offset;
+	r->dir_x = cub->camera.dir_x[x];
+	r->dir_y = cub->camera.dir_y[x];
+	r->delta_x = cub->camera.delta_x[x];
+	r->delta_y = cub->camera.delta_y[x];
 	r->map_x = (int)p->x;
 	r->map_y = (int)p->y;
+	r->door = -1;
+	r->transient = false;
+	r->layer = NULL;
+	if (cub->layers)
+		r->layer = cub->layers + x * MAX_LAYERS;
+	r->layers = 0;
+	r->clip = cub->screen_height;
 	if (r->map_y < 0)
 		r->map_y = 0;
 	if (r->map_y >= cub->map.height)
 		r->map_y = cub->map.height - 1;
 	if (r->map_x < 0)
 		r->map_x = 0;
-	if (r->map_x >= (int)ft_strlen(cub->map.grid[r->map_y]))
-		r->map_x = (int)ft_strlen(cub->map.grid[r->map_y]) - 1;
-	calc_delta(r);
+	if (r->map_x >= cub->map.width)
+		r->map_x = cub->map.width - 1;
 	calc_step_side(p, r);
 }
 
 /**
  * @brief Security check: if the ray excedes the map's limits,
  * consider it a hit.
+ * @note Both walls and out-of-grid tiles are solid in the occupancy grid,
+ * so a single bit test covers them. Door tiles are solid too until their
+ * door is fully open; the ray only stops there if it meets the panel.
+ * Grates are solid as well, and the ray usually walks on through them.
+ * With wall heights, it may also go on past a wall (see height_blocks).
  */
 static bool	reaches_map_limit(t_cub3d *cub, t_ray *r)
 {
-	if (r->map_y < 0 || r->map_y >= cub->map.height)
-	{
-		r->hit = 1;
-		return (1);
-	}
-	if (r->map_x < 0)
-	{
-		r->hit = 1;
-		return (1);
-	}
-	if (r->map_x >= (int)ft_strlen(cub->map.grid[r->map_y]))
-	{
-		r->hit = 1;
-		return (1);
-	}
-	if (cub->map.grid[r->map_y][r->map_x] == '1')
+	if (is_solid(&cub->map, r->map_x, r->map_y)
+		&& (!cub->map.door_of || door_blocks(cub, r))
+		&& (!cub->map.grates || grate_blocks(cub, r))
+		&& (!cub->map.heights || height_blocks(cub, r)))
 	{
 		r->hit = 1;
 		return (1);
@@ -81,12 +79,19 @@ static bool	reaches_map_limit(t_cub3d *cub, t_ray *r)
 /**
 * @brief DDA algorithm iteration: rays keep moving forward
 * until they hit a wall or map limit.
+* @note Before each step the ray leaps over any empty square around it
+* (see skip_empty_space), so open areas cost a few iterations only.
+* This is the double precision kernel, and the reference the float and
+* fixed-point ones are validated against.
+* With a VIEW_DISTANCE, the walk stops as soon as the next grid line is
+* beyond it, leaving hit at 0: the column is then drawn as fog.
 */
-static void	perform_dda(t_cub3d *cub, t_ray *r)
+void	perform_dda(t_cub3d *cub, t_ray *r)
 {
 	r->hit = 0;
 	while (r->hit == 0)
 	{
+		skip_empty_space(&cub->map, r);
 		if (r->side_x < r->side_y)
 		{
 			r->side_x += r->delta_x;
@@ -101,62 +106,73 @@ static void	perform_dda(t_cub3d *cub, t_ray *r)
 		}
 		if (reaches_map_limit(cub, r))
 			break ;
+		if (VIEW_DISTANCE > 0 && fmin(r->side_x, r->side_y) > VIEW_DISTANCE)
+			break ;
 	}
 }
 
 /**
-* @brief Draws the vertical wall line with the corresponding texture.
-*/
-static void	draw_wall_line_textured(t_cub3d *cub, t_ray *r, int x)
+ * @brief Finds the wall hit by an initialized ray: from the angular ray
+ * cache when the player has only rotated since it was filled, otherwise by
+ * stepping through the grid with the selected DDA kernel (the result is
+ * then stored in the cache).
+ * @param cub Pointer to the main t_cub3d structure.
+ * @param r Ray set up by init_ray_vars.
+ */
+void	trace_ray(t_cub3d *cub, t_ray *r)
 {
-	t_img	*tex;
-	int		y;
-	int		tex_x;
-	int		tex_y;
-	char	*dst;
-
-	tex = select_wall_texture(cub, r);
-	tex_x = calc_wall_tex_x(cub, r, tex);
-	tex_x = clamp(tex_x, 0, tex->width -1);
-	y = r->start;
-	while (y <= r->end)
-	{
-		tex_y = y * 256 - cub->screen_height * 128 + r->line_h * 128;
-		tex_y = (tex_y * tex->height / r->line_h) / 256;
-		tex_y = clamp(tex_y, 0, tex->height -1);
-		dst = tex->data + (tex_y * tex->line_len + tex_x * (tex->bpp / 8));
-		put_pixel(&cub->frame, x, y, ((unsigned char)dst[2] << 16) | \
-			((unsigned char)dst[1] << 8) | (unsigned char)dst[0]);
-		y++;
-	}
+	if (ray_cache_fetch(&cub->ray_cache, r))
+		return ;
+	if (cub->dda_precision == DDA_FLOAT)
+		dda_float(&cub->map, &cub->player, r);
+	else if (cub->dda_precision == DDA_FIXED)
+		dda_fixed(&cub->map, &cub->player, r);
+	else
+		perform_dda(cub, r);
+	ray_cache_store(&cub->ray_cache, r);
 }
 
 /**
  * @brief The main raycasting loop.
- * Iterates through every vertical column of the screen to render the 3D scene.
+ * Casts one ray per vertical column of the screen into the ray buffer, then
+ * draws the 3D scene from it. The ray directions of the frame are already
+ * swept (see render_frame).
  * @param cub Pointer to the main t_cub3d structure.
  * @details
  * The algorithm (DDA) follows these steps for each vertical strip (column):
  * 1. **Initialization:** Calculate ray direction and position.
  * 2. **Step Calculation:** Determine delta distances and initial side
  * distances.
- * 3. **DDA Execution:** Step through the grid until a wall is hit.
+ * 3. **DDA Execution:** Step through the grid until a wall is hit, unless
+ * the angular ray cache already knows the hit for this direction (the
+ * player has only rotated since it was filled).
+ * In interlaced mode, the columns skipped this frame are filled in a second
+ * pass, once both of their neighbours are known (see cast_column). A third
+ * pass copies the ray of foveated column groups to their other columns.
+ * Then, span by span (runs of columns hitting the same face):
  * 4. **Projection:** Calculate the perpendicular distance (to avoid fish-eye)
  * and determining line height.
  * 5. **Rendering:** Select the texture and draw the vertical line.
  */
 void	raycast(t_cub3d *cub)
 {
-	t_ray	r;
-	int		x;
+	int	pass;
+	int	x;
 
-	x = 0;
-	while (x < cub->screen_width)
+	ray_cache_sync(cub);
+	interlace_sync(cub);
+	cub->stats.frames++;
+	pass = 0;
+	while (pass < 3)
 	{
-		init_ray_vars(cub, &r, x);
-		perform_dda(cub, &r);
-		calc_line_params(cub, &r);
-		draw_wall_line_textured(cub, &r, x);
-		x++;
+		x = 0;
+		while (x < cub->screen_width)
+		{
+			if (column_pass(cub, x) == pass)
+				cast_column(cub, x);
+			x++;
+		}
+		pass++;
 	}
+	draw_wall_spans(cub);
 }
@@ -6,33 +6,12 @@
 /*   By: sergio-jimenez <sergio-jimenez@student.    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/18 17:07:23 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/12/11 13:28:34 by sergio-jime      ###   ########.fr       */
+/*   Updated: 2026/10/19 01:53:26 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "cub3d.h"
 
-/**
-* @brief Calculates relative distance from the ray 
-* till the next grid line (x and y).
-* @param delta_x and @param delta_y represent the 
-* distance that the ray needs to cross the line.
-* It accumulates full distance in each iteration.
-* @note fabs is used to avoid negative value, 
-* and 1e30 to avoid divisions by zero.
-*/
-void	calc_delta(t_ray *r)
-{
-	if (r->dir_x == 0)
-		r->delta_x = 1e30;
-	else
-		r->delta_x = fabs(1.0 / r->dir_x);
-	if (r->dir_y == 0)
-		r->delta_y = 1e30;
-	else
-		r->delta_y = fabs(1.0 / r->dir_y);
-}
-
 /**
  * @brief Helper function to calculate step and initial side distance
  * for the X-axis.
@@ -113,25 +92,25 @@ void	calc_step_side(t_player *p, t_ray *r)
 }
 
 /**
-* @brief Claculates the line to be drawn and the side of the wall in which
-* the ray hits, using the perpendicular distance (to avoid fish-eye).
-* We also clamp values to avoid extremely big numbers, or division by zero.
+* @brief Clamps the projected wall height and computes the screen rows where
+* the wall line starts and ends (centered on the horizon, kept in `mid`).
+* Looking up or down only moves the horizon (see t_player::pitch): a
+* y-shear, so the columns are scaled exactly as with a level view.
+* @note r->line_h must already hold the projected height (see wall_spans.c).
+* It is kept in [1, 10 * screen_height] to avoid extremely big numbers, and
+* divisions by zero for walls further than screen_height tiles away.
 */
 void	calc_line_params(t_cub3d *cub, t_ray *r)
 {
-	if (r->side == 0)
-		r->perp = (r->map_x - cub->player.x + (1 - r->step_x) / 2) / r->dir_x;
-	else
-		r->perp = (r->map_y - cub->player.y + (1 - r->step_y) / 2) / r->dir_y;
-	if (r->perp <= 0.0)
-		r->perp = 0.0001;
-	r->line_h = (int)(cub->screen_height / r->perp);
 	if (r->line_h > cub->screen_height * 10)
 		r->line_h = cub->screen_height * 10;
-	r->start = -r->line_h / 2 + cub->screen_height / 2;
+	if (r->line_h < 1)
+		r->line_h = 1;
+	r->mid = cub->screen_height / 2 + cub->player.pitch;
+	r->start = -r->line_h / 2 + r->mid;
 	if (r->start < 0)
 		r->start = 0;
-	r->end = r->line_h / 2 + cub->screen_height / 2;
+	r->end = r->line_h / 2 + r->mid;
 	if (r->end >= cub->screen_height)
 		r->end = cub->screen_height - 1;
 }
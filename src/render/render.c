@@ -6,7 +6,7 @@
 /*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/23 16:43:45 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/12/04 09:56:57 by vjan-nie         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:27:39 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -48,43 +48,26 @@ void	put_pixel(t_img *img, int x, int y, int color)
 		dst[3] = (color >> 24) & 0xFF;
 }
 
-/**
- * @brief Draws a full horizontal line with the corresponding color
- * (ceiling or floor).
- */
-static void	fill_line(t_img *img, int y, int color)
-{
-	int	x;
-
-	x = 0;
-	while (x < img->width)
-	{
-		put_pixel(img, x, y, color);
-		x++;
-	}
-}
-
 /**
  * @brief Draws the background split in two horizontal parts:
- * ceiling first(upper side) and floor, which have their color 
- * assigned in the map file.
+ * ceiling first(upper side) and floor, which have their color
+ * or texture assigned in the map file.
+ * @note Works in bands of FLOOR_BAND rows away from the horizon, as many
+ * as the taller of the floor and ceiling parts takes; the bands share no
+ * state, so they could be handed out to separate workers.
  */
 static void	draw_background(t_cub3d *cub)
 {
-	int	y;
-	int	half;
+	int	p;
 
-	y = 0;
-	half = cub->screen_height / 2;
-	while (y < half)
-	{
-		fill_line(&cub->frame, y, cub->map.ceiling_color);
-		y++;
-	}
-	while (y < cub->screen_height)
+	if (cub->sky_u)
+		sky_sweep(cub);
+	p = 0;
+	while (p < cub->screen_height - cub->screen_height / 2
+		+ abs(cub->player.pitch))
 	{
-		fill_line(&cub->frame, y, cub->map.floor_color);
-		y++;
+		draw_floor_band(cub, p, p + FLOOR_BAND);
+		p += FLOOR_BAND;
 	}
 }
 
@@ -108,11 +91,23 @@ void	create_frame(t_cub3d *cub, t_img *img)
 }
 
 /**
- * @brief Main rendering function: we first draw the background,
- * then we use raycasting to draw the walls.
+ * @brief Main rendering function: we first sweep the ray direction of every
+ * column, which the sky and the walls share, and draw the background,
+ * then we use raycasting to draw the walls, and the sprites over them. The
+ * layers still pending, nearer than every sprite of their column, go
+ * on top. With PLAYER_TORCH, the torch light is moved to the player
+ * beforehand. The frame clock of the animated walls then ticks.
  */
 void	render_frame(t_cub3d *cub)
 {
+	if (PLAYER_TORCH > 0)
+		move_dyn_light(&cub->map, 0, cub->player.x, cub->player.y);
+	camera_sweep(cub);
 	draw_background(cub);
 	raycast(cub);
+	if (cub->views)
+		draw_sprites(cub);
+	if (cub->layers)
+		flush_layers(cub);
+	cub->clock++;
 }
@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_init.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:20:12 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:14:37 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file render_init.c
+ * @brief Allocation and release of the buffers owned by the renderer.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Sets up the optional parts of the renderer: fog, dynamic lights,
+ * shaded textures, animated walls, sky, layers and sprites.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @return bool True on success, false on allocation failure.
+ */
+static bool	init_effects(t_cub3d *cub)
+{
+	if (!init_fog(cub))
+		return (false);
+	if (RENDER_STATS)
+		bench_dyn_lights();
+	if (PLAYER_TORCH > 0 && add_dyn_light(&cub->map, cub->player.x,
+			cub->player.y, PLAYER_TORCH) < 0)
+		return (false);
+	if (!init_shading(cub) || !init_anims(cub))
+		return (false);
+	if (!init_sky(cub) || !init_layers(cub))
+		return (false);
+	return (init_sprites(cub));
+}
+
+/**
+ * @brief Allocates the per-frame render buffers.
+ * Must run after the window (screen size) and the player are initialized.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @return bool True on success, false on allocation failure.
+ */
+bool	init_renderer(t_cub3d *cub)
+{
+	cub->rays = ft_calloc(cub->screen_width, sizeof(t_ray));
+	if (!cub->rays)
+		return (ft_error("Malloc failed\n"), false);
+	if (!init_ray_cache(cub))
+		return (false);
+	if (!init_column_cache(&cub->col_cache))
+		return (false);
+	if (!init_camera(cub))
+		return (false);
+	if (!init_effects(cub))
+		return (false);
+	select_dda(cub);
+	if (RENDER_STATS && !cub->map.doors && !cub->map.grates
+		&& !cub->map.heights)
+		validate_dda(cub);
+	return (true);
+}
+
+/**
+ * @brief Frees every buffer allocated by `init_renderer`.
+ * Safe to call on a partially initialized renderer.
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+void	free_renderer(t_cub3d *cub)
+{
+	free(cub->rays);
+	cub->rays = NULL;
+	free(cub->ray_cache.entries);
+	cub->ray_cache.entries = NULL;
+	free_column_cache(&cub->col_cache);
+	free(cub->camera.offset);
+	cub->camera.offset = NULL;
+	free(cub->fog_lut);
+	cub->fog_lut = NULL;
+	free_shading(cub);
+	free_anims(cub);
+	free(cub->sky_u);
+	cub->sky_u = NULL;
+	free(cub->views);
+	cub->views = NULL;
+	free(cub->sprite_order);
+	cub->sprite_order = NULL;
+	free_sprite_runs(cub);
+	free(cub->layers);
+	cub->layers = NULL;
+	free(cub->grate_opaque);
+	cub->grate_opaque = NULL;
+}
@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_stats.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:24:51 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:13:04 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file render_stats.c
+ * @brief Renderer statistics printed on exit by builds made with
+ * `make stats` (RENDER_STATS=1).
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Prints the hit rate and the memory use of the column cache.
+ * @param c Pointer to the column cache.
+ */
+static void	print_column_cache_stats(t_col_cache *c)
+{
+	long	lookups;
+
+	lookups = c->hits + c->misses;
+	if (lookups == 0)
+		lookups = 1;
+	printf("column cache: %ld hits, %ld misses (%.1f%% hit rate), "
+		"%ld evictions\n", c->hits, c->misses, 100.0 * c->hits / lookups,
+		c->evictions);
+	printf("column cache: %zu / %zu KB used\n", c->used / 1024,
+		c->budget / 1024);
+}
+
+/**
+ * @brief Prints the rays traced per frame and, for interlaced rendering,
+ * how many columns were reconstructed and how many of those differ from a
+ * traced ray (the reconstruction error), with the share of the pixels
+ * that may differ from a full cast, on average and on the worst frame.
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+static void	print_ray_stats(t_cub3d *cub)
+{
+	t_render_stats	*s;
+	double			frames;
+	double			screen;
+	long			worst;
+
+	s = &cub->stats;
+	frames = fmax(s->frames, 1);
+	screen = (double)cub->screen_width * cub->screen_height;
+	worst = s->worst_diff;
+	if (s->frame_diff > worst)
+		worst = s->frame_diff;
+	printf("rays: %ld frames, %.1f rays/frame\n", s->frames,
+		s->rays / frames);
+	printf("interlace: %.1f columns/frame reconstructed, %ld mismatches "
+		"(%.3f%%)\n", s->reconstructed / frames, s->mismatches,
+		100.0 * s->mismatches / fmax(s->reconstructed, 1));
+	printf("interlace: %.4f%% of the pixels differ from a full cast, "
+		"%.4f%% on the worst frame\n", 100.0 * s->diff_pixels / frames
+		/ screen, 100.0 * worst / screen);
+}
+
+/**
+ * @brief Prints how many layers the rays stored per frame, how many of
+ * them are walls drawn over others, and why the rays that stopped on a
+ * grate or a wall they could have gone past did.
+ * @param s Pointer to the render counters.
+ */
+static void	print_layer_stats(t_render_stats *s)
+{
+	double	frames;
+
+	frames = fmax(s->frames, 1);
+	printf("layers: %.1f layers/frame (up to %d per column), "
+		"%.1f rays/frame stopped by the cap, %.1f by an opaque column\n",
+		(s->layers + s->walls) / frames, MAX_LAYERS, s->capped / frames,
+		s->opaque / frames);
+	printf("heights: %.1f walls/frame drawn as layers\n", s->walls / frames);
+}
+
+/**
+ * @brief Prints the statistics gathered by the renderer since start-up.
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+void	print_render_stats(t_cub3d *cub)
+{
+	print_ray_stats(cub);
+	print_column_cache_stats(&cub->col_cache);
+	if (cub->map.grates || cub->map.heights)
+		print_layer_stats(&cub->stats);
+	if (cub->map.sprite_count > 0)
+		printf("sprites: %.1f drawn/frame, %.1f hidden by the pvs, "
+			"out of %d\n",
+			(double)cub->stats.sprites / fmax(cub->stats.frames, 1),
+			(double)cub->stats.hidden / fmax(cub->stats.frames, 1),
+			cub->map.sprite_count);
+}
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   reproject.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:15:40 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 01:28:36 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file reproject.c
+ * @brief Reconstruction of a skipped column from known wall faces.
+ * The previous frame's hit in the same column (a real ray then, as the
+ * parity flips every frame) and the hits of both neighbours (neighbouring
+ * groups with foveated rendering), cast this frame, are reprojected
+ * through the current camera: the face that the column's ray actually
+ * crosses, nearest first, is taken as its hit.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Distance along a ray to the face hit by another ray.
+ * The face is the one `f` hit: side, tile and the direction it was seen
+ * from. It only counts if the ray approaches it from the same side and
+ * crosses it within the tile.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param r Ray of the column to reconstruct.
+ * @param f Ray whose hit face is tested.
+ * @return double The perpendicular distance to the face, -1 if missed.
+ */
+static double	face_depth(t_cub3d *cub, t_ray *r, t_ray *f)
+{
+	double	depth;
+	double	along;
+
+	if (f->side == 0 && r->step_x == f->step_x && r->dir_x != 0)
+	{
+		depth = (f->map_x - cub->player.x + (1 - f->step_x) / 2) / r->dir_x;
+		along = cub->player.y + depth * r->dir_y;
+		if (depth > 0 && (int)floor(along) == f->map_y)
+			return (depth);
+	}
+	else if (f->side == 1 && r->step_y == f->step_y && r->dir_y != 0)
+	{
+		depth = (f->map_y - cub->player.y + (1 - f->step_y) / 2) / r->dir_y;
+		along = cub->player.x + depth * r->dir_x;
+		if (depth > 0 && (int)floor(along) == f->map_x)
+			return (depth);
+	}
+	return (-1);
+}
+
+/**
+ * @brief Keeps the face hit by `f` in `best` if the ray crosses it nearer
+ * than the face already kept (and within the view distance).
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param r Ray of the column to reconstruct.
+ * @param f Candidate ray.
+ * @param best Nearest face so far (map_x, map_y, side) and its distance
+ * in perp, negative while none was found.
+ */
+static void	keep_nearest(t_cub3d *cub, t_ray *r, t_ray *f, t_ray *best)
+{
+	double	depth;
+
+	if (!f->hit || f->door >= 0)
+		return ;
+	depth = face_depth(cub, r, f);
+	if (VIEW_DISTANCE > 0 && depth > VIEW_DISTANCE)
+		return ;
+	if (depth > 0 && (best->perp < 0 || depth < best->perp))
+	{
+		best->map_x = f->map_x;
+		best->map_y = f->map_y;
+		best->side = f->side;
+		best->perp = depth;
+	}
+}
+
+/**
+ * @brief Reconstructs the hit of a skipped column.
+ * Any candidate face crossed by the ray belongs to a wall, so the real hit
+ * is never farther than the nearest one; it is exact whenever the real
+ * face is among the candidates.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param r Ray of the column, set up by init_ray_vars.
+ * @param prev Ray of the same column at the previous frame.
+ * @param x Screen column (first of its foveated group).
+ * @return bool True if the hit was reconstructed, false if no candidate
+ * face is on the ray and it must be traced.
+ */
+bool	reproject_column(t_cub3d *cub, t_ray *r, t_ray *prev, int x)
+{
+	t_ray	best;
+
+	best.perp = -1;
+	keep_nearest(cub, r, prev, &best);
+	if (x > 0)
+		keep_nearest(cub, r, &cub->rays[column_rep(cub, x - 1)], &best);
+	x += column_stride(cub, x);
+	if (x < cub->screen_width)
+		keep_nearest(cub, r, &cub->rays[x], &best);
+	if (best.perp < 0)
+		return (false);
+	r->map_x = best.map_x;
+	r->map_y = best.map_y;
+	r->side = best.side;
+	r->hit = 1;
+	r->perp = best.perp;
+	return (true);
+}
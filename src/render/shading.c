@@ -0,0 +1,164 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shading.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:12:40 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:00:23 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file shading.c
+ * @brief Distance and side shading, and baked lights, through pre-shaded
+ * texture copies.
+ * Each wall texture (the four walls, doors and grates) gets SHADE_LEVELS
+ * copies with every texel already
+ * scaled by the level's brightness. Shading a column is then just picking
+ * the copy to sample from, so the texture kernel stays a plain copy and the
+ * column cache tells shade levels apart by their texture pointer.
+ * Memory: 4 * SHADE_LEVELS * texture size (about 20 MB for 200x200 textures
+ * at 32 levels).
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Fills one shaded copy: every texel of `src` scaled by
+ * `scale` / 256, two channels per multiply. The alpha byte is kept, so
+ * transparent texels stay transparent.
+ * @param src Source texture.
+ * @param dst Shaded copy; its data buffer is already allocated.
+ * @param scale Brightness in 1/256 units (0..256).
+ */
+static void	shade_copy(t_img *src, t_img *dst, unsigned int scale)
+{
+	unsigned int	*in;
+	unsigned int	*out;
+	unsigned int	c;
+	long			i;
+	long			n;
+
+	in = (unsigned int *)src->data;
+	out = (unsigned int *)dst->data;
+	n = (long)src->line_len / 4 * src->height;
+	i = 0;
+	while (i < n)
+	{
+		c = in[i];
+		out[i] = (((c & 0xFF00FF) * scale >> 8) & 0xFF00FF)
+			| (((c & 0x00FF00) * scale >> 8) & 0x00FF00) | (c & 0xFF000000);
+		i++;
+	}
+}
+
+/**
+ * @brief Builds the SHADE_LEVELS copies of one texture in a single block.
+ * Level 0 is full brightness; each further level removes 1 / SHADE_LEVELS.
+ * @param tex Source texture.
+ * @param shades First of its SHADE_LEVELS shaded copies.
+ * @return bool True on success, false on allocation failure.
+ */
+static bool	build_shades(t_img *tex, t_img *shades)
+{
+	char	*block;
+	long	size;
+	int		k;
+
+	size = (long)tex->line_len * tex->height;
+	block = malloc(size * SHADE_LEVELS);
+	if (!block)
+		return (ft_error("Malloc failed\n"), false);
+	k = 0;
+	while (k < SHADE_LEVELS)
+	{
+		shades[k] = *tex;
+		shades[k].img_ptr = NULL;
+		shades[k].data = block + size * k;
+		shade_copy(tex, &shades[k], 256 * (SHADE_LEVELS - k) / SHADE_LEVELS);
+		k++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Builds the shaded copies of the four wall textures, and of the
+ * door and grate textures when the map has them. The copies of texture i
+ * start at `cub->shades[i * SHADE_LEVELS]`.
+ * Must run after the textures are loaded. Does nothing unless SHADING or
+ * the map has baked or dynamic lights.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @return bool True on success, false on allocation failure.
+ */
+bool	init_shading(t_cub3d *cub)
+{
+	int	i;
+
+	if (!SHADING && !cub->map.light && !cub->map.dyn.level)
+		return (true);
+	cub->shades = ft_calloc(TEX_COUNT * SHADE_LEVELS, sizeof(t_img));
+	if (!cub->shades)
+		return (ft_error("Malloc failed\n"), false);
+	i = 0;
+	while (i < TEX_COUNT)
+	{
+		if ((i < 4 || i == TEX_DOOR || i == TEX_GRATE)
+			&& has_texture(cub, i)
+			&& !build_shades(&cub->textures[i], &cub->shades[i * SHADE_LEVELS]))
+			return (false);
+		i++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Frees the shaded copies. Safe on a partial `init_shading`.
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+void	free_shading(t_cub3d *cub)
+{
+	int	i;
+
+	if (!cub->shades)
+		return ;
+	i = 0;
+	while (i < TEX_COUNT)
+	{
+		free(cub->shades[i * SHADE_LEVELS].data);
+		i++;
+	}
+	free(cub->shades);
+	cub->shades = NULL;
+}
+
+/**
+ * @brief Picks the copy of `tex` to draw a column with. With SHADING, one
+ * level darker every SHADE_DISTANCE / SHADE_LEVELS tiles, plus SHADE_SIDE
+ * levels on north/south faces so the two wall orientations read apart;
+ * the baked light of the column then scales the remaining brightness.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param tex Wall texture of the column: one of `cub->textures`, or a frame
+ * view of an animated one, whose shaded views follow it.
+ * @param r Ray of the column, with `perp` set.
+ * @param light Baked brightness of the column, in 1/256 units.
+ * @return t_img* The texture to sample, `tex` itself without shaded copies.
+ */
+t_img	*shade_texture(t_cub3d *cub, t_img *tex, t_ray *r, int light)
+{
+	double	level;
+
+	if (!cub->shades)
+		return (tex);
+	level = 0;
+	if (SHADING)
+		level = r->perp * (SHADE_LEVELS / SHADE_DISTANCE)
+			+ r->side * SHADE_SIDE;
+	level = SHADE_LEVELS - (SHADE_LEVELS - fmin(level, SHADE_LEVELS))
+		* light / 256.0;
+	if (level > SHADE_LEVELS - 1)
+		level = SHADE_LEVELS - 1;
+	if (tex < cub->textures || tex >= cub->textures + TEX_COUNT)
+		return (tex + 1 + (int)level);
+	return (&cub->shades[(tex - cub->textures) * SHADE_LEVELS + (int)level]);
+}
@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sky.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:41:07 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 02:27:39 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file sky.c
+ * @brief Panoramic sky (SKY texture) drawn in place of the ceiling.
+ * The panorama wraps the full turn horizontally and spans the ceiling half
+ * of the screen vertically, above the level horizon; looking up shows its
+ * top row above it. Each frame, every screen column looks up once
+ * which panorama column faces its ray; a ceiling row is then a copy from a
+ * single panorama row through that lookup, with no per-pixel math.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Allocates the per-column panorama lookup. Does nothing when the
+ * map has no sky.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @return bool True on success, false on allocation failure.
+ */
+bool	init_sky(t_cub3d *cub)
+{
+	if (!has_texture(cub, TEX_SKY))
+		return (true);
+	cub->sky_u = malloc(cub->screen_width * sizeof(int));
+	if (!cub->sky_u)
+		return (ft_error("Malloc failed\n"), false);
+	return (true);
+}
+
+/**
+ * @brief Finds, for every screen column, the panorama column facing its
+ * ray, from the ray angle (the panorama covers the full turn). The rays are
+ * those of the walls (see camera_sweep), which must be swept first.
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+void	sky_sweep(t_cub3d *cub)
+{
+	double	scale;
+	int		x;
+
+	scale = cub->textures[TEX_SKY].width / (2.0 * M_PI);
+	x = 0;
+	while (x < cub->screen_width)
+	{
+		cub->sky_u[x] = (int)((atan2(cub->camera.dir_y[x],
+						cub->camera.dir_x[x]) + M_PI) * scale);
+		if (cub->sky_u[x] >= cub->textures[TEX_SKY].width)
+			cub->sky_u[x] = cub->textures[TEX_SKY].width - 1;
+		x++;
+	}
+}
+
+/**
+ * @brief Draws ceiling row `y` from the panorama row at the same relative
+ * height above the horizon, through the per-column lookup.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param row First pixel of the frame row.
+ * @param y Frame row, above the horizon.
+ */
+void	draw_sky_row(t_cub3d *cub, unsigned int *row, int y)
+{
+	t_img			*tex;
+	unsigned int	*src;
+	int				x;
+
+	tex = &cub->textures[TEX_SKY];
+	y = clamp((long)(y - cub->player.pitch) * tex->height
+			/ (cub->screen_height / 2), 0, tex->height - 1);
+	src = (unsigned int *)(tex->data + (long)y * tex->line_len);
+	x = 0;
+	while (x < cub->screen_width)
+	{
+		row[x] = src[cub->sky_u[x]];
+		x++;
+	}
+}
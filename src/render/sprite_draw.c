@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sprite_draw.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:47:26 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 01:53:26 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file sprite_draw.c
+ * @brief Draws a projected sprite column by column. Columns where a wall
+ * is nearer than the sprite are skipped, as are transparent texels (the
+ * XPM "None" colour, which MiniLibX loads with the alpha byte set): either
+ * tested one by one, or never visited when the texture is run-encoded.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Scales texture column `tex_x` of a sprite onto screen column x,
+ * leaving the frame untouched under transparent texels.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param v Projected sprite.
+ * @param x Screen column.
+ * @param tex_x Texture column.
+ */
+static void	draw_sprite_column(t_cub3d *cub, t_sprite_view *v, int x,
+	int tex_x)
+{
+	unsigned int	*dst;
+	char			*src;
+	unsigned int	c;
+	int				pos;
+	int				y;
+
+	y = v->top;
+	pos = 0;
+	if (y < 0)
+	{
+		pos = -y * v->step;
+		y = 0;
+	}
+	src = v->tex->data + tex_x * (v->tex->bpp / 8);
+	dst = (unsigned int *)(cub->frame.data + y * cub->frame.line_len) + x;
+	while (y++ < cub->screen_height && (pos >> 16) < v->tex->height)
+	{
+		c = *(unsigned int *)(src + (pos >> 16) * v->tex->line_len);
+		if (!(c & 0xFF000000) && v->fog)
+			*dst = fog_blend(c, v->fog);
+		else if (!(c & 0xFF000000))
+			*dst = c;
+		dst += cub->frame.line_len / 4;
+		pos += v->step;
+	}
+}
+
+/**
+ * @brief Copies the screen rows covered by one opaque run. They are the
+ * rows whose texture row, (y - top) * step in 16.16, falls inside the run,
+ * i.e. exactly the rows the per-texel kernel would have written.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param v Projected sprite (step, fog, top and runs set).
+ * @param run Run to draw.
+ * @param x Screen column.
+ */
+static void	copy_span(t_cub3d *cub, t_sprite_view *v, t_tex_run *run, int x)
+{
+	unsigned int	*dst;
+	unsigned int	*src;
+	int				pos;
+	int				y;
+	int				y_end;
+
+	y = v->top + (((long)run->start << 16) + v->step - 1) / v->step;
+	y_end = v->top + (((long)(run->start + run->len) << 16) + v->step - 1)
+		/ v->step;
+	y = clamp(y, 0, cub->screen_height);
+	y_end = clamp(y_end, 0, cub->screen_height);
+	pos = (y - v->top) * v->step;
+	src = v->runs->texels + run->offset - run->start;
+	dst = (unsigned int *)(cub->frame.data + y * cub->frame.line_len) + x;
+	while (y++ < y_end)
+	{
+		*dst = src[pos >> 16];
+		if (v->fog)
+			*dst = fog_blend(*dst, v->fog);
+		dst += cub->frame.line_len / 4;
+		pos += v->step;
+	}
+}
+
+/**
+ * @brief Draws column tex_x of a run-encoded sprite onto screen column x,
+ * run by run.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param v Projected sprite.
+ * @param x Screen column.
+ * @param tex_x Texture column.
+ */
+static void	draw_run_column(t_cub3d *cub, t_sprite_view *v, int x, int tex_x)
+{
+	int	i;
+
+	i = v->runs->first[tex_x];
+	while (i < v->runs->first[tex_x + 1])
+		copy_span(cub, v, &v->runs->runs[i++], x);
+}
+
+/**
+ * @brief Draws the on-screen columns of a projected sprite that are not
+ * hidden behind the wall of their column, from its opaque runs with
+ * SPRITE_RLE, texel by texel otherwise. The layers of a column that
+ * are farther than the sprite are composited first.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param v Projected sprite.
+ */
+void	draw_sprite(t_cub3d *cub, t_sprite_view *v)
+{
+	int	x;
+	int	end;
+	int	tex_x;
+
+	v->step = ((long)v->tex->height << 16) / v->height;
+	v->top = (cub->screen_height - v->height) / 2 + cub->player.pitch;
+	v->fog = 0;
+	if (cub->fog_lut)
+		v->fog = cub->fog_lut[clamp(v->height, 0, cub->screen_height)];
+	x = clamp(v->left, 0, cub->screen_width);
+	end = clamp(v->left + v->width, 0, cub->screen_width);
+	while (x < end)
+	{
+		tex_x = (long)(x - v->left) * v->tex->width / v->width;
+		if (cub->rays[x].layers && v->depth < cub->rays[x].perp)
+			draw_layers(cub, x, v->depth);
+		if (v->depth < cub->rays[x].perp && v->runs)
+			draw_run_column(cub, v, x, tex_x);
+		else if (v->depth < cub->rays[x].perp)
+			draw_sprite_column(cub, v, x, tex_x);
+		x++;
+	}
+}
@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sprite_rle.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:12:40 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/18 19:12:40 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file sprite_rle.c
+ * @brief Load-time encoding of sprite textures into runs of opaque texels.
+ * Works on the images decoded by load_textures: every column is split into
+ * runs of non-transparent texels, and only those texels are kept, packed
+ * column by column, so a drawn column reads them sequentially.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Tells whether texel (x, y) of a texture is transparent.
+ */
+static bool	is_clear(t_img *tex, int x, int y)
+{
+	return (*(unsigned int *)(tex->data + y * tex->line_len
+			+ x * (tex->bpp / 8)) & 0xFF000000);
+}
+
+/**
+ * @brief Counts the runs and the opaque texels of a texture.
+ * @param tex Decoded texture.
+ * @param count count[0] receives the runs, count[1] the opaque texels.
+ */
+static void	count_runs(t_img *tex, long *count)
+{
+	int	x;
+	int	y;
+
+	count[0] = 0;
+	count[1] = 0;
+	x = 0;
+	while (x < tex->width)
+	{
+		y = 0;
+		while (y < tex->height)
+		{
+			if (!is_clear(tex, x, y))
+			{
+				count[0] += (y == 0 || is_clear(tex, x, y - 1));
+				count[1]++;
+			}
+			y++;
+		}
+		x++;
+	}
+}
+
+/**
+ * @brief Appends the runs and opaque texels of texture column x.
+ * @param tex Decoded texture.
+ * @param r Runs being built; `first[x]` is already set.
+ * @param x Texture column.
+ * @param texel Number of texels packed so far, updated.
+ */
+static void	encode_column(t_img *tex, t_sprite_runs *r, int x, long *texel)
+{
+	t_tex_run	*run;
+	int			n;
+	int			y;
+
+	n = r->first[x];
+	run = NULL;
+	y = 0;
+	while (y < tex->height)
+	{
+		if (!is_clear(tex, x, y) && (y == 0 || is_clear(tex, x, y - 1)))
+		{
+			run = &r->runs[n++];
+			run->start = y;
+			run->len = 0;
+			run->offset = *texel;
+		}
+		if (!is_clear(tex, x, y))
+		{
+			r->texels[(*texel)++] = *(unsigned int *)(tex->data
+					+ y * tex->line_len + x * (tex->bpp / 8));
+			run->len++;
+		}
+		y++;
+	}
+	r->first[x + 1] = n;
+}
+
+/**
+ * @brief Encodes a decoded sprite texture into opaque runs. RENDER_STATS
+ * builds print the memory used next to the size of the plain texture.
+ * @param tex Decoded texture.
+ * @param r Runs to fill; freed by free_sprite_runs, even on failure.
+ * @return bool True on success, false on allocation failure.
+ */
+bool	encode_sprite_runs(t_img *tex, t_sprite_runs *r)
+{
+	long	count[2];
+	long	texel;
+	int		x;
+
+	count_runs(tex, count);
+	r->first = malloc((tex->width + 1) * sizeof(int));
+	r->runs = malloc((count[0] + 1) * sizeof(t_tex_run));
+	r->texels = malloc((count[1] + 1) * sizeof(unsigned int));
+	if (!r->first || !r->runs || !r->texels)
+		return (ft_error("Malloc failed\n"), false);
+	r->bytes = (tex->width + 1) * sizeof(int) + count[0] * sizeof(t_tex_run)
+		+ count[1] * sizeof(unsigned int);
+	r->first[0] = 0;
+	texel = 0;
+	x = 0;
+	while (x < tex->width)
+		encode_column(tex, r, x++, &texel);
+	if (RENDER_STATS)
+		printf("sprite runs: %dx%d texture, %ld runs, %ld bytes instead of "
+			"%ld (%ld saved)\n", tex->width, tex->height, count[0], r->bytes,
+			(long)tex->width * tex->height * 4,
+			(long)tex->width * tex->height * 4 - r->bytes);
+	return (true);
+}
+
+/**
+ * @brief Frees the runs of every sprite texture.
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+void	free_sprite_runs(t_cub3d *cub)
+{
+	int	i;
+
+	i = 0;
+	while (i < SPRITE_TYPES)
+	{
+		free(cub->sprite_runs[i].first);
+		free(cub->sprite_runs[i].runs);
+		free(cub->sprite_runs[i].texels);
+		ft_bzero(&cub->sprite_runs[i], sizeof(t_sprite_runs));
+		i++;
+	}
+}
@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sprites.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:31:12 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 01:10:25 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file sprites.c
+ * @brief Billboard sprites: culling, projection and back-to-front order.
+ * Sprites are drawn after the walls, far to near, column by column against
+ * the per-column depth left in the ray buffer by the wall pass. Each one
+ * is first looked up in the potentially visible set of the player's tile
+ * (see pvs.c), then moved into camera space and rejected if it lies behind
+ * the camera, past the view distance or outside the field of view before
+ * projection.
+ * The order is kept from one frame to the next and sorted by distance to
+ * the player, which does not change when the player only turns and
+ * barely changes when it walks, so an insertion sort of the previous
+ * order does little more than one pass.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Allocates the per-frame table of projected sprites and the
+ * drawing order and, with SPRITE_RLE, encodes the sprite textures into
+ * opaque runs. Must run after the textures are loaded.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @return bool True on success, false on allocation failure.
+ */
+bool	init_sprites(t_cub3d *cub)
+{
+	int	i;
+
+	if (cub->map.sprite_count == 0)
+		return (true);
+	cub->views = malloc(cub->map.sprite_count * sizeof(t_sprite_view));
+	cub->sprite_order = malloc(cub->map.sprite_count * sizeof(int));
+	if (!cub->views || !cub->sprite_order)
+		return (ft_error("Malloc failed\n"), false);
+	i = 0;
+	while (i < cub->map.sprite_count)
+	{
+		cub->sprite_order[i] = i;
+		i++;
+	}
+	i = 0;
+	while (SPRITE_RLE && i < SPRITE_TYPES)
+	{
+		if (has_texture(cub, TEX_SPRITE + i) && !encode_sprite_runs(
+				&cub->textures[TEX_SPRITE + i], &cub->sprite_runs[i]))
+			return (false);
+		i++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Moves a sprite into camera space, culls it and projects it.
+ * depth is the distance along the view direction and lat the sideways
+ * offset in camera plane units, so the sprite center lies on the ray of
+ * camera offset -lat / depth. Half a tile wide sprites reach 0.5 / |plane|
+ * plane units to each side, which is what the frustum test allows for.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param s Sprite.
+ * @param v Projected sprite, filled if it is visible.
+ * @return bool True if the sprite may be visible.
+ */
+static bool	project_sprite(t_cub3d *cub, t_sprite *s, t_sprite_view *v)
+{
+	t_player	*p;
+	double		det;
+	double		lat;
+	double		plane;
+
+	p = &cub->player;
+	det = p->dir_x * p->plane_y - p->plane_x * p->dir_y;
+	v->depth = ((s->x - p->x) * p->plane_y - (s->y - p->y) * p->plane_x)
+		/ det;
+	lat = (p->dir_x * (s->y - p->y) - p->dir_y * (s->x - p->x)) / det;
+	plane = sqrt(p->plane_x * p->plane_x + p->plane_y * p->plane_y);
+	if (v->depth < SPRITE_NEAR || fabs(lat) - 0.5 / plane >= v->depth
+		|| (VIEW_DISTANCE > 0 && v->depth >= VIEW_DISTANCE))
+		return (false);
+	v->width = (int)fmin(cub->screen_width / (2 * plane * v->depth),
+			cub->screen_width * 10);
+	v->height = (int)fmin(cub->screen_height / v->depth,
+			cub->screen_height * 10);
+	v->left = (int)((1 - lat / v->depth) * cub->screen_width / 2)
+		- v->width / 2;
+	v->tex = &cub->textures[TEX_SPRITE + s->type];
+	v->runs = NULL;
+	if (SPRITE_RLE)
+		v->runs = &cub->sprite_runs[s->type];
+	return (v->width > 0 && v->height > 0);
+}
+
+/**
+ * @brief Updates the distance of every sprite and insertion-sorts the
+ * drawing order, farthest first. Starting from the previous frame's order,
+ * each sprite only moves past the few it overtook since.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param s Sprites of the map.
+ * @param order Drawing order to update.
+ */
+static void	sort_sprites(t_cub3d *cub, t_sprite *s, int *order)
+{
+	int	i;
+	int	j;
+	int	cur;
+
+	i = 0;
+	while (i < cub->map.sprite_count)
+	{
+		s[i].dist = (s[i].x - cub->player.x) * (s[i].x - cub->player.x)
+			+ (s[i].y - cub->player.y) * (s[i].y - cub->player.y);
+		i++;
+	}
+	i = 1;
+	while (i < cub->map.sprite_count)
+	{
+		cur = order[i];
+		j = i;
+		while (j > 0 && s[order[j - 1]].dist < s[cur].dist)
+		{
+			order[j] = order[j - 1];
+			j--;
+		}
+		order[j] = cur;
+		i++;
+	}
+}
+
+/**
+ * @brief Sorts the sprites of the map far to near, culls and projects them
+ * in that order and draws the visible ones over the walls. Sprites outside
+ * the potentially visible set of the player's tile are dropped first.
+ * Must run after the wall pass, which leaves the depth of every column in
+ * `cub->rays[x].perp` (VIEW_DISTANCE for fog columns).
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+void	draw_sprites(t_cub3d *cub)
+{
+	t_sprite	*s;
+	int			from;
+	int			i;
+
+	sort_sprites(cub, cub->map.sprites, cub->sprite_order);
+	from = (int)cub->player.y * cub->map.width + (int)cub->player.x;
+	cub->view_count = 0;
+	i = 0;
+	while (i < cub->map.sprite_count)
+	{
+		s = &cub->map.sprites[cub->sprite_order[i++]];
+		if (!pvs_visible(&cub->map, from,
+				(int)s->y * cub->map.width + (int)s->x))
+			cub->stats.hidden++;
+		else if (project_sprite(cub, s, &cub->views[cub->view_count]))
+			cub->view_count++;
+	}
+	i = 0;
+	while (i < cub->view_count)
+		draw_sprite(cub, &cub->views[i++]);
+	cub->stats.sprites += cub->view_count;
+}
@@ -6,7 +6,7 @@
 /*   By: sergio-jimenez <sergio-jimenez@student.    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/16 18:01:08 by vjan-nie          #+#    #+#             */
-/*   Updated: 2025/12/10 14:08:51 by sergio-jime      ###   ########.fr       */
+/*   Updated: 2026/10/19 02:00:23 by vjan-nie         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -18,40 +18,24 @@
  * @note r->side refers to which kind of wall did the ray hit:
  * 0: vertical (x)
  * 1: horizontal (y)
+ * Door panels all use the door texture (DO), and grates the grate one (GR).
+ * An animated wall gives the view of its current frame (see anim.c).
  */
 t_img	*select_wall_texture(t_cub3d *cub, t_ray *r)
 {
-	if (r->side == 0)
-	{
-		if (r->step_x < 0)
-			return (&cub->textures[2]);
-		return (&cub->textures[3]);
-	}
-	else
-	{
-		if (r->step_y < 0)
-			return (&cub->textures[0]);
-		return (&cub->textures[1]);
-	}
-}
-
-/**
- * @brief Calculates the x axis coordinate of the texture.
- */
-int	calc_wall_tex_x(t_cub3d *cub, t_ray *r, t_img *tex)
-{
-	double	wall_x;
-	int		tex_x;
+	int	i;
 
+	if (r->door >= 0)
+		return (&cub->textures[TEX_DOOR]);
+	if (is_grate(&cub->map, r->map_x, r->map_y))
+		return (&cub->textures[TEX_GRATE]);
 	if (r->side == 0)
-		wall_x = cub->player.y + r->perp * r->dir_y;
+		i = 2 + (r->step_x > 0);
 	else
-		wall_x = cub->player.x + r->perp * r->dir_x;
-	wall_x -= floor(wall_x);
-	tex_x = (int)(wall_x * tex->width);
-	if ((r->side == 0 && r->dir_x > 0) || (r->side == 1 && r->dir_y < 0))
-		tex_x = tex->width - tex_x - 1;
-	return (tex_x);
+		i = (r->step_y > 0);
+	if (cub->map.anims[i].count)
+		return (anim_frame(cub, i));
+	return (&cub->textures[i]);
 }
 
 /**
@@ -96,7 +80,8 @@ static bool	check_paths(t_map *map)
 }
 
 /**
- * @brief Loads wall textures from the given map file paths.
+ * @brief Loads wall textures from the given map file paths, then the
+ * optional floor and ceiling textures if the map names them.
  */
 bool	load_textures(t_cub3d *cub)
 {
@@ -105,11 +90,24 @@ bool	load_textures(t_cub3d *cub)
 	if (!check_paths(&cub->map))
 		return (false);
 	i = 0;
-	while (i < 4)
+	while (i < TEX_COUNT)
 	{
-		if (!load_one_texture(cub, &cub->textures[i], cub->map.tex_paths[i]))
+		if (cub->map.tex_paths[i] && !load_one_texture(cub,
+				&cub->textures[i], cub->map.tex_paths[i]))
 			return (false);
 		i++;
 	}
 	return (true);
 }
+
+/**
+ * @brief Tells whether an optional texture (TEX_FLOOR, TEX_CEILING) was
+ * given in the map file and loaded.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param index Index in `cub->textures`.
+ * @return bool True if the texture is available.
+ */
+bool	has_texture(t_cub3d *cub, int index)
+{
+	return (cub->textures[index].data != NULL);
+}
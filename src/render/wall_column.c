@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wall_column.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:10:37 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 01:53:26 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file wall_column.c
+ * @brief Scales a texture column onto one screen column, going through the
+ * cache of pre-scaled columns when it is enabled.
+ * Distant walls and slow movement reuse the same (texture, tex_x, line_h)
+ * triples frame after frame; a cached run replaces the per-pixel texture
+ * stepping by a plain strided copy.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Scales the texture column of a projected ray into `dst`.
+ * The texture row advances by a constant 16.16 fixed-point step, so there is
+ * no division per pixel, and texels are copied as whole 32-bit words. The
+ * fog weight only depends on the wall height, so it is looked up once.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param r Projected ray (tex, tex_x, line_h, start and end set).
+ * @param dst First destination pixel (row `start`).
+ * @param stride Distance in pixels between two destination rows.
+ */
+static void	scale_column(t_cub3d *cub, t_ray *r, unsigned int *dst,
+	int stride)
+{
+	char	*src;
+	int		step;
+	int		pos;
+	int		y;
+	int		fog;
+
+	fog = 0;
+	if (cub->fog_lut)
+		fog = cub->fog_lut[clamp(r->line_h, 0, cub->screen_height)];
+	step = ((long)r->tex->height << 16) / r->line_h;
+	pos = ((long)(2 * (r->start - r->mid) + r->line_h)
+			* ((long)r->tex->height << 16)) / (2 * r->line_h);
+	src = r->tex->data + r->tex_x * (r->tex->bpp / 8);
+	y = r->start;
+	while (y <= r->end)
+	{
+		if ((pos >> 16) >= r->tex->height)
+			pos = (r->tex->height - 1) << 16;
+		*dst = *(unsigned int *)(src + (pos >> 16) * r->tex->line_len)
+			& 0xFFFFFF;
+		if (fog)
+			*dst = fog_blend(*dst, fog);
+		dst += stride;
+		pos += step;
+		y++;
+	}
+}
+
+/**
+ * @brief Copies a cached run into rows start..end of a screen column.
+ * @param dst First destination pixel (row `start`).
+ * @param run Cached pixels.
+ * @param len Number of pixels.
+ * @param stride Distance in pixels between two destination rows.
+ */
+static void	copy_run(unsigned int *dst, unsigned int *run, int len,
+	int stride)
+{
+	while (len-- > 0)
+	{
+		*dst = *run++;
+		dst += stride;
+	}
+}
+
+/**
+ * @brief Draws the vertical wall line of a projected ray with its texture.
+ * On a cache hit the pre-scaled run is copied; on a miss the column is
+ * scaled into a new cache entry first. Walls that do not fit on the screen
+ * are clipped, change with every step and would flush the cache, so they
+ * are scaled straight into the frame, as is everything when the cache is
+ * disabled or the run does not fit.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param r Projected ray of the column.
+ * @param x Screen column.
+ */
+void	draw_wall_line_textured(t_cub3d *cub, t_ray *r, int x)
+{
+	unsigned int	*dst;
+	unsigned int	*run;
+	int				stride;
+
+	stride = cub->frame.line_len / 4;
+	dst = (unsigned int *)(cub->frame.data + r->start * cub->frame.line_len)
+		+ x;
+	run = NULL;
+	if (cub->col_cache.budget > 0 && r->start == r->mid - r->line_h / 2
+		&& r->end == r->mid + r->line_h / 2
+		&& !col_cache_find(&cub->col_cache, r, &run)
+		&& col_cache_insert(&cub->col_cache, r, &run))
+		scale_column(cub, r, run, 1);
+	if (run)
+		copy_run(dst, run, r->end - r->start + 1, stride);
+	else
+		scale_column(cub, r, dst, stride);
+}
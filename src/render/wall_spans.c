@@ -0,0 +1,151 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wall_spans.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: vjan-nie <vjan-nie@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:04:31 by vjan-nie          #+#    #+#             */
+/*   Updated: 2026/10/19 01:48:55 by vjan-nie         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file wall_spans.c
+ * @brief Draws the walls from the per-column ray buffer, one span at a time.
+ * Adjacent columns very often hit the same face of the same tile. Such a run
+ * of columns (a span) shares its texture, its face plane and its texture
+ * orientation, so those are set up once. For a flat face, the inverse
+ * perpendicular distance is linear in the ray direction, which gives every
+ * column its distance, wall height and texture column with a few multiplies.
+ */
+#include "cub3d.h"
+
+/**
+ * @brief Tells whether two rays hit the same face of the same tile.
+ */
+static bool	same_face(t_ray *a, t_ray *b)
+{
+	return (a->map_x == b->map_x && a->map_y == b->map_y
+		&& a->side == b->side);
+}
+
+/**
+ * @brief Sets up the constants of a span from the first ray that hits it.
+ * The face plane is x = map_x (+1 when looking west) for vertical faces and
+ * y = map_y (+1 when looking north) for horizontal ones; door panels stand
+ * half a tile further in. The height of the face is looked up once too.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param s Span to fill.
+ * @param r First ray of the span.
+ */
+static void	init_span(t_cub3d *cub, t_span *s, t_ray *r)
+{
+	t_player	*p;
+	double		face;
+
+	p = &cub->player;
+	s->tex = select_wall_texture(cub, r);
+	s->height = wall_height(&cub->map, r->map_x, r->map_y);
+	face = (1 - r->step_x) / 2;
+	if (r->side == 1)
+		face = (1 - r->step_y) / 2;
+	if (r->door >= 0)
+		face = 0.5;
+	if (r->side == 0)
+	{
+		s->inv_depth = 1.0 / (r->map_x - p->x + face);
+		s->origin = p->y;
+		s->flip = r->dir_x > 0;
+	}
+	else
+	{
+		s->inv_depth = 1.0 / (r->map_y - p->y + face);
+		s->origin = p->x;
+		s->flip = r->dir_y < 0;
+	}
+}
+
+/**
+ * @brief Projects one column of a span.
+ * 1 / perp is the ray component across the face times the span's inverse
+ * depth, which yields the wall height directly; the hit point along the face
+ * gives the texture column (shifted with the panel on doors).
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param s Span the column belongs to.
+ * @param r Ray of the column; tex, perp, line_h, start, end and tex_x are
+ * set.
+ */
+static void	project_column(t_cub3d *cub, t_span *s, t_ray *r)
+{
+	double	inv;
+	double	wall_x;
+
+	inv = r->dir_y * s->inv_depth;
+	wall_x = r->dir_x;
+	if (r->side == 0)
+	{
+		inv = r->dir_x * s->inv_depth;
+		wall_x = r->dir_y;
+	}
+	r->perp = 1.0 / inv;
+	r->line_h = (int)fmin(cub->screen_height * inv, cub->screen_height * 10);
+	calc_line_params(cub, r);
+	wall_x = s->origin + r->perp * wall_x;
+	wall_x -= floor(wall_x);
+	r->tex = shade_texture(cub, s->tex, r, face_light(&cub->map, r, wall_x));
+	if (r->door >= 0)
+		wall_x -= cub->map.doors[r->door].open;
+	r->tex_x = (int)(wall_x * s->tex->width);
+	if (s->flip)
+		r->tex_x = s->tex->width - r->tex_x - 1;
+	r->tex_x = clamp(r->tex_x, 0, s->tex->width - 1);
+}
+
+/**
+ * @brief Draws one column of a span; faces of other heights than the
+ * standard one go through draw_face, which the column cache does not
+ * cover.
+ * @param cub Pointer to the main t_cub3d context structure.
+ * @param s Span the column belongs to.
+ * @param x Screen column.
+ */
+static void	draw_column(t_cub3d *cub, t_span *s, int x)
+{
+	if (column_pass(cub, x) == 2)
+		replicate_column(cub, x);
+	else if (!cub->rays[x].hit)
+		draw_fog_column(cub, &cub->rays[x], x);
+	else
+	{
+		project_column(cub, s, &cub->rays[x]);
+		if (s->height != 1)
+			draw_face(cub, &cub->rays[x], x, s->height);
+		else
+			draw_wall_line_textured(cub, &cub->rays[x], x);
+	}
+}
+
+/**
+ * @brief Walks the ray buffer, splitting it into spans of columns that hit
+ * the same face, and draws every column of each span.
+ * @param cub Pointer to the main t_cub3d context structure.
+ */
+void	draw_wall_spans(t_cub3d *cub)
+{
+	t_span	s;
+	int		x;
+	int		last;
+
+	x = 0;
+	while (x < cub->screen_width)
+	{
+		last = x;
+		while (last + 1 < cub->screen_width
+			&& same_face(&cub->rays[x], &cub->rays[last + 1]))
+			last++;
+		init_span(cub, &s, &cub->rays[x]);
+		while (x <= last)
+			draw_column(cub, &s, x++);
+	}
+}